@@ -0,0 +1,76 @@
+#include <arba/rand/alias_table.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+class benchmark_alias_table
+{
+public:
+    using duration_type = std::chrono::duration<double, ::std::chrono::milliseconds::period>;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::size_t nb_samples = 20'000'000;
+
+private:
+    static void print_(std::string_view title, duration_type duration, std::size_t nb_values)
+    {
+        std::cout << "  " << std::left << std::setw(52) << title << std::right << std::fixed << std::setprecision(3)
+                  << "  D(ms): " << duration.count() << "  " << duration.count() * 1e6 / nb_values << "ns/value"
+                  << std::endl;
+    }
+
+    static duration_type measure_(auto function)
+    {
+        const auto start_time_point = clock_type::now();
+        function();
+        return clock_type::now() - start_time_point;
+    }
+
+public:
+    void run(std::size_t nb_categories)
+    {
+        std::vector<double> weights(nb_categories);
+        rand::xorshift64_engine rng(42);
+        std::ranges::generate(weights, [&] { return double(rng() % 1'000'000); });
+        std::vector<uint32_t> samples(nb_samples);
+
+        std::cout << "## " << nb_categories << " categories" << std::endl;
+        {
+            std::discrete_distribution<uint32_t> distribution;
+            const auto build_fn = [&]
+            { distribution = std::discrete_distribution<uint32_t>(weights.cbegin(), weights.cend()); };
+            print_("std::discrete_distribution build", measure_(build_fn), nb_categories);
+            print_("std::discrete_distribution sample",
+                   measure_([&] { std::ranges::generate(samples, [&] { return distribution(rng); }); }), nb_samples);
+        }
+        {
+            rand::alias_table table;
+            print_("rand::alias_table build seq", measure_([&] { table = rand::alias_table(weights); }), nb_categories);
+            print_("rand::alias_table build par",
+                   measure_([&] { table = rand::alias_table(weights, std::execution::par); }), nb_categories);
+            print_("rand::alias_table sample rand::xorshift64_engine",
+                   measure_([&] { std::ranges::generate(samples, [&] { return table(rng); }); }), nb_samples);
+            rand::xorshift64_range_engine<> rnrg(42);
+            print_("rand::alias_table batch rand::xorshift64_range_engine<>",
+                   measure_([&] { table(std::span(samples), rnrg); }), nb_samples);
+        }
+    }
+};
+
+int main()
+{
+    benchmark_alias_table benchmark;
+    benchmark.run(100'000);
+    benchmark.run(10'000'000);
+
+    std::cout << "EXIT SUCCESS" << std::endl;
+    return EXIT_SUCCESS;
+}
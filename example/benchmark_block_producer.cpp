@@ -0,0 +1,102 @@
+#include <arba/rand/rnrg/block_producer.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+// Consumers reading blocks of 256 KiB, each block being followed by some work: compares the latency of a block
+// generated inline with the latency of a block acquired from a block_producer, for several ring sizes.
+class benchmark_block_producer
+{
+public:
+    using duration_type = std::chrono::duration<double, ::std::chrono::microseconds::period>;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::size_t block_bytes = 256 * 1024;
+    static constexpr unsigned nb_requests = 2000;
+
+private:
+    // Work done by a request between two blocks.
+    static uint64_t work_(std::span<const uint64_t> values, unsigned nb_rounds)
+    {
+        uint64_t sum = 0;
+        for (unsigned round = 0; round < nb_rounds; ++round)
+            for (uint64_t value : values)
+                sum += value >> round;
+        return sum;
+    }
+
+    static void print_(std::string_view title, duration_type mean, duration_type max)
+    {
+        std::cout << "  " << std::left << std::setw(40) << title << std::right << std::fixed << std::setprecision(3)
+                  << "  mean(us): " << mean.count() << "  max(us): " << max.count() << std::endl;
+    }
+
+public:
+    void run_inline(unsigned nb_work_rounds)
+    {
+        rand::xorshift64_range_engine<> rnrg(42);
+        std::vector<uint64_t> block(block_bytes / sizeof(uint64_t));
+        duration_type total{ 0 };
+        duration_type max{ 0 };
+        uint64_t sum = 0;
+        for (unsigned i = 0; i < nb_requests; ++i)
+        {
+            const auto start_time_point = clock_type::now();
+            rnrg(std::span(block), cppx::endianness_specific);
+            const duration_type duration = clock_type::now() - start_time_point;
+            total += duration;
+            max = std::max(max, duration);
+            sum += work_(block, nb_work_rounds);
+        }
+        volatile uint64_t sink = sum;
+        (void)sink;
+        print_("inline xorshift64_range_engine<>", total / nb_requests, max);
+    }
+
+    void run_producer(std::size_t nb_blocks, unsigned nb_work_rounds)
+    {
+        rand::block_producer<rand::xoron64_range_engine<>> producer(42, block_bytes, nb_blocks);
+        duration_type total{ 0 };
+        duration_type max{ 0 };
+        uint64_t sum = 0;
+        for (unsigned i = 0; i < nb_requests; ++i)
+        {
+            const auto start_time_point = clock_type::now();
+            const auto handle = producer.acquire();
+            const duration_type duration = clock_type::now() - start_time_point;
+            total += duration;
+            max = std::max(max, duration);
+            sum += work_(handle.integers(), nb_work_rounds);
+        }
+        volatile uint64_t sink = sum;
+        (void)sink;
+        print_("block_producer " + std::to_string(nb_blocks) + " blocks", total / nb_requests, max);
+
+        const rand::block_producer_metrics metrics = producer.metrics();
+        std::cout << "    stalls: " << metrics.nb_stalls << "/" << metrics.nb_acquired_blocks
+                  << "  stall(us): " << duration_type(metrics.total_stall_duration).count()
+                  << "  refill mean(us): " << duration_type(metrics.mean_refill_duration()).count()
+                  << "  refill max(us): " << duration_type(metrics.max_refill_duration).count() << std::endl;
+    }
+};
+
+int main()
+{
+    benchmark_block_producer benchmark;
+    for (unsigned nb_work_rounds : { 1u, 4u })
+    {
+        std::cout << "## " << nb_work_rounds << " work round(s) per block" << std::endl;
+        benchmark.run_inline(nb_work_rounds);
+        for (std::size_t nb_blocks : { 2u, 4u, 16u })
+            benchmark.run_producer(nb_blocks, nb_work_rounds);
+    }
+
+    std::cout << "EXIT SUCCESS" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,193 @@
+#include <arba/rand/algorithm/rand_ints.hpp>
+#include <arba/rand/rand.hpp>
+#include <arba/rand/rng/buffered_engine.hpp>
+#include <arba/rand/rng/counter_based_engine.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+#include <arba/rand/rng/romu_engine.hpp>
+#include <arba/rand/rng/sfc64_engine.hpp>
+#include <arba/rand/rng/splitmix64_engine.hpp>
+#include <arba/rand/rng/urng.hpp>
+#include <arba/rand/rng/wyrand_engine.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rng/xoshiro_engine.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+class benchmark_rand_int
+{
+public:
+    using duration_type = std::chrono::duration<double, ::std::chrono::nanoseconds::period>;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr unsigned nb_calls = 50'000'000;
+
+private:
+    // Builds the distribution at each call, like rand_int() does.
+    template <template <class> class DistributionT, std::integral IntType>
+    static double ns_per_call_(std::uniform_random_bit_generator auto& rng, IntType min, IntType max)
+    {
+        IntType sum = 0;
+        const auto start_time_point = clock_type::now();
+        for (unsigned i = 0; i < nb_calls; ++i)
+            sum += DistributionT<IntType>(min, max)(rng);
+        const duration_type duration = clock_type::now() - start_time_point;
+        volatile IntType sink = sum;
+        (void)sink;
+        return duration.count() / nb_calls;
+    }
+
+    template <std::integral IntType>
+    static void compare_(std::string_view title, std::uniform_random_bit_generator auto& rng, IntType min, IntType max)
+    {
+        const double std_ns = ns_per_call_<std::uniform_int_distribution>(rng, min, max);
+        const double rand_ns = ns_per_call_<rand::uniform_int_distribution>(rng, min, max);
+        std::cout << "  " << std::left << std::setw(36) << title << std::right << std::fixed << std::setprecision(3)
+                  << "  std: " << std_ns << "ns  rand: " << rand_ns << "ns  speedup: " << std::setprecision(2)
+                  << std_ns / rand_ns << "x" << std::endl;
+    }
+
+public:
+    void run(std::string_view engine_name, std::uniform_random_bit_generator auto& rng)
+    {
+        std::cout << "## " << engine_name << std::endl;
+        compare_<uint8_t>("uint8_t [0, 5]", rng, 0, 5);
+        compare_<uint32_t>("uint32_t [1, 100]", rng, 1, 100);
+        compare_<uint32_t>("uint32_t [0, 3'000'000'000]", rng, 0, 3'000'000'000u);
+        compare_<int32_t>("int32_t [-1'000'000, 1'000'000]", rng, -1'000'000, 1'000'000);
+        compare_<uint64_t>("uint64_t [0, 999'999'999'999]", rng, 0, 999'999'999'999ull);
+        compare_<uint64_t>("uint64_t [0, 2^63 + 2^62]", rng, 0, (1ull << 63) + (1ull << 62));
+    }
+
+    // Latency of a bare call to the engine.
+    void run_raw(std::string_view engine_name, std::uniform_random_bit_generator auto& rng)
+    {
+        using result_type = std::remove_cvref_t<decltype(rng())>;
+        result_type sum = 0;
+        const auto start_time_point = clock_type::now();
+        for (unsigned i = 0; i < nb_calls; ++i)
+            sum += rng();
+        const duration_type duration = clock_type::now() - start_time_point;
+        volatile result_type sink = sum;
+        (void)sink;
+        std::cout << "  " << std::left << std::setw(36) << engine_name << std::right << std::fixed
+                  << std::setprecision(3) << "  " << duration.count() / nb_calls << "ns" << std::endl;
+    }
+
+    // Latency of a call to the functions using the global engine of the thread.
+    template <std::integral IntType>
+    void run_global(std::string_view title, auto rand_function)
+    {
+        IntType sum = 0;
+        const auto start_time_point = clock_type::now();
+        for (unsigned i = 0; i < nb_calls; ++i)
+            sum += rand_function();
+        const duration_type duration = clock_type::now() - start_time_point;
+        volatile IntType sink = sum;
+        (void)sink;
+        std::cout << "  " << std::left << std::setw(36) << title << std::right << std::fixed << std::setprecision(3)
+                  << "  " << duration.count() / nb_calls << "ns" << std::endl;
+    }
+
+    // Fills a span of nb_calls integers with rand_ints().
+    template <std::integral IntType>
+    void run_bulk(std::string_view title, auto& rng, IntType min, IntType max, auto... execution_policy)
+    {
+        std::vector<IntType> ints(nb_calls);
+        const auto start_time_point = clock_type::now();
+        rand::rand_ints(std::span(ints), min, max, rng, execution_policy...);
+        const duration_type duration = clock_type::now() - start_time_point;
+        const double gb_per_s = (ints.size() * sizeof(IntType)) / duration.count();
+        std::cout << "  " << std::left << std::setw(56) << title << std::right << std::fixed << std::setprecision(3)
+                  << "  " << duration.count() / nb_calls << "ns  " << std::setprecision(2) << gb_per_s << "GB/s"
+                  << std::endl;
+    }
+};
+
+int main()
+{
+    benchmark_rand_int benchmark;
+    rand::xorshift64_engine xorshift64_rng(42);
+    benchmark.run("rand::xorshift64_engine", xorshift64_rng);
+    rand::xorshift32_engine xorshift32_rng(42);
+    benchmark.run("rand::xorshift32_engine", xorshift32_rng);
+    rand::xoshiro256ss_engine xoshiro256ss_rng(42);
+    benchmark.run("rand::xoshiro256ss_engine", xoshiro256ss_rng);
+    rand::xoroshiro128plus_engine xoroshiro128plus_rng(42);
+    benchmark.run("rand::xoroshiro128plus_engine", xoroshiro128plus_rng);
+    rand::pcg32_engine pcg32_rng(42);
+    benchmark.run("rand::pcg32_engine", pcg32_rng);
+#ifdef __SIZEOF_INT128__
+    rand::pcg64_engine pcg64_rng(42);
+    benchmark.run("rand::pcg64_engine", pcg64_rng);
+    rand::pcg64_dxsm_engine pcg64_dxsm_rng(42);
+    benchmark.run("rand::pcg64_dxsm_engine", pcg64_dxsm_rng);
+#endif
+    rand::philox4x32_engine<> philox4x32_rng(42);
+    benchmark.run("rand::philox4x32_engine<>", philox4x32_rng);
+    rand::threefry2x64_engine<> threefry2x64_rng(42);
+    benchmark.run("rand::threefry2x64_engine<>", threefry2x64_rng);
+    rand::splitmix64_engine splitmix64_rng(42);
+    benchmark.run("rand::splitmix64_engine", splitmix64_rng);
+    rand::wyrand_engine wyrand_rng(42);
+    benchmark.run("rand::wyrand_engine", wyrand_rng);
+    rand::sfc64_engine sfc64_rng(42);
+    benchmark.run("rand::sfc64_engine", sfc64_rng);
+    rand::romu_trio_engine romu_trio_rng(42);
+    benchmark.run("rand::romu_trio_engine", romu_trio_rng);
+    rand::romu_duo_jr_engine romu_duo_jr_rng(42);
+    benchmark.run("rand::romu_duo_jr_engine", romu_duo_jr_rng);
+    std::mt19937_64 mt19937_64_rng(42);
+    benchmark.run("std::mt19937_64", mt19937_64_rng);
+    rand::buffered_engine<rand::xoron64_range_engine<>> buffered_xoron64_rng(42);
+    benchmark.run("rand::buffered_engine<xoron64_range_engine<>>", buffered_xoron64_rng);
+
+    std::cout << "## raw calls" << std::endl;
+    benchmark.run_raw("rand::xoshiro256ss_engine", xoshiro256ss_rng);
+    benchmark.run_raw("rand::splitmix64_engine", splitmix64_rng);
+    benchmark.run_raw("rand::wyrand_engine", wyrand_rng);
+    benchmark.run_raw("rand::sfc64_engine", sfc64_rng);
+    benchmark.run_raw("rand::romu_trio_engine", romu_trio_rng);
+    benchmark.run_raw("rand::romu_duo_jr_engine", romu_duo_jr_rng);
+    benchmark.run_raw("std::mt19937_64", mt19937_64_rng);
+    rand::urng_u32<> urng_u32_rng(42);
+    benchmark.run_raw("rand::urng_u32<>", urng_u32_rng);
+    rand::fast_urng_u32<> fast_urng_u32_rng(42);
+    benchmark.run_raw("rand::fast_urng_u32<>", fast_urng_u32_rng);
+    rand::urng_u8<1, 6> urng_u8_rng(42);
+    benchmark.run_raw("rand::urng_u8<1, 6>", urng_u8_rng);
+    rand::fast_urng_u8<1, 6> fast_urng_u8_rng(42);
+    benchmark.run_raw("rand::fast_urng_u8<1, 6>", fast_urng_u8_rng);
+
+    std::cout << "## global engine" << std::endl;
+    benchmark.run_global<uint64_t>("rand_u64()", [] { return rand::rand_u64(); });
+    benchmark.run_global<uint32_t>("rand_u32(1, 100)", [] { return rand::rand_u32(1, 100); });
+    benchmark.run_global<int32_t>("rand_i32(-1'000'000, 1'000'000)",
+                                  [] { return rand::rand_i32(-1'000'000, 1'000'000); });
+
+    std::cout << "## rand_ints" << std::endl;
+    benchmark.run_bulk<uint32_t>("rand::xorshift64_engine uint32_t [1, 100]", xorshift64_rng, 1, 100);
+    rand::xorshift64_range_engine<> xorshift64_rnrg(42);
+    benchmark.run_bulk<uint32_t>("rand::xorshift64_range_engine<> uint32_t [1, 100]", xorshift64_rnrg, 1, 100);
+    benchmark.run_bulk<uint32_t>("rand::xorshift64_range_engine<> par uint32_t [1, 100]", xorshift64_rnrg, 1, 100,
+                                 std::execution::par);
+    benchmark.run_bulk<uint16_t>("rand::xorshift64_range_engine<> uint16_t [1, 6]", xorshift64_rnrg, 1, 6);
+    benchmark.run_bulk<uint64_t>("rand::xorshift64_range_engine<> uint64_t [0, 999'999'999'999]", xorshift64_rnrg,
+                                 0, 999'999'999'999ull);
+    rand::xoron64_range_engine<> xoron64_rnrg(42);
+    benchmark.run_bulk<uint32_t>("rand::xoron64_range_engine<> uint32_t [1, 100]", xoron64_rnrg, 1, 100);
+    benchmark.run_bulk<uint64_t>("rand::xoron64_range_engine<> uint64_t [0, 999'999'999'999]", xoron64_rnrg, 0,
+                                 999'999'999'999ull);
+
+    std::cout << "EXIT SUCCESS" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+#include <arba/rand/algorithm/rand_exponentials.hpp>
+#include <arba/rand/algorithm/rand_normals.hpp>
+#include <arba/rand/exponential_distribution.hpp>
+#include <arba/rand/normal_distribution.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+class benchmark_rand_normals
+{
+public:
+    using duration_type = std::chrono::duration<double, ::std::chrono::nanoseconds::period>;
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr std::size_t nb_values = 50'000'000;
+
+    void run(std::string_view title, auto generate_fn)
+    {
+        const auto start_time_point = clock_type::now();
+        generate_fn(std::span(values_));
+        const duration_type duration = clock_type::now() - start_time_point;
+        std::cout << "  " << std::left << std::setw(60) << title << std::right << std::fixed << std::setprecision(3)
+                  << "  " << duration.count() / values_.size() << "ns/value" << std::endl;
+    }
+
+private:
+    std::vector<double> values_ = std::vector<double>(nb_values);
+};
+
+int main()
+{
+    benchmark_rand_normals benchmark;
+
+    std::cout << "## normal" << std::endl;
+    benchmark.run("std::normal_distribution std::mt19937_64",
+                  [](std::span<double> values)
+                  {
+                      std::mt19937_64 rng(42);
+                      std::normal_distribution<> distribution;
+                      std::ranges::generate(values, [&] { return distribution(rng); });
+                  });
+    benchmark.run("std::normal_distribution rand::xorshift64_engine",
+                  [](std::span<double> values)
+                  {
+                      rand::xorshift64_engine rng(42);
+                      std::normal_distribution<> distribution;
+                      std::ranges::generate(values, [&] { return distribution(rng); });
+                  });
+    benchmark.run("rand::normal_distribution std::mt19937_64",
+                  [](std::span<double> values)
+                  {
+                      std::mt19937_64 rng(42);
+                      rand::normal_distribution<> distribution;
+                      std::ranges::generate(values, [&] { return distribution(rng); });
+                  });
+    benchmark.run("rand::normal_distribution rand::xorshift64_engine",
+                  [](std::span<double> values)
+                  {
+                      rand::xorshift64_engine rng(42);
+                      rand::normal_distribution<> distribution;
+                      std::ranges::generate(values, [&] { return distribution(rng); });
+                  });
+    benchmark.run("rand::rand_normals rand::xorshift64_range_engine<>",
+                  [](std::span<double> values)
+                  {
+                      rand::xorshift64_range_engine<> rnrg(42);
+                      rand::rand_normals(values, rnrg);
+                  });
+    benchmark.run("rand::rand_normals rand::xorshift64_range_engine<> par",
+                  [](std::span<double> values)
+                  {
+                      rand::xorshift64_range_engine<> rnrg(42);
+                      rand::rand_normals(values, rnrg, std::execution::par);
+                  });
+    benchmark.run("rand::rand_normals rand::xoron64_range_engine<>",
+                  [](std::span<double> values)
+                  {
+                      rand::xoron64_range_engine<> rnrg(42);
+                      rand::rand_normals(values, rnrg);
+                  });
+
+    std::cout << "## exponential" << std::endl;
+    benchmark.run("std::exponential_distribution std::mt19937_64",
+                  [](std::span<double> values)
+                  {
+                      std::mt19937_64 rng(42);
+                      std::exponential_distribution<> distribution;
+                      std::ranges::generate(values, [&] { return distribution(rng); });
+                  });
+    benchmark.run("rand::exponential_distribution rand::xorshift64_engine",
+                  [](std::span<double> values)
+                  {
+                      rand::xorshift64_engine rng(42);
+                      rand::exponential_distribution<> distribution;
+                      std::ranges::generate(values, [&] { return distribution(rng); });
+                  });
+    benchmark.run("rand::rand_exponentials rand::xorshift64_range_engine<>",
+                  [](std::span<double> values)
+                  {
+                      rand::xorshift64_range_engine<> rnrg(42);
+                      rand::rand_exponentials(values, rnrg);
+                  });
+
+    std::cout << "EXIT SUCCESS" << std::endl;
+    return EXIT_SUCCESS;
+}
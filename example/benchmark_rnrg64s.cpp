@@ -1,11 +1,22 @@
+#include <arba/rand/algorithm/rand_reals.hpp>
 #include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+#include <arba/rand/rnrg/chacha_range_engine.hpp>
+#include <arba/rand/rnrg/counter_based_range_engine.hpp>
 #include <arba/rand/rnrg/rnrg_benchmark.hpp>
+#include <arba/rand/rnrg/urng_range_engine.hpp>
+#include <arba/rand/rnrg/xoron32_range_engine.hpp>
 #include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xoron64_stream_engine.hpp>
 #include <arba/rand/rnrg/xorshift_range_engine.hpp>
+#include <arba/rand/rnrg/xoshiro_range_engine.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <ranges>
 #include <vector>
 
@@ -31,6 +42,12 @@ private:
                            benchmark.compute_integer_uniqueness_index ? "U" : "");
     }
 
+    // The durations of the measurements are printed apart from the durations of the generations.
+    static bool has_indexes_(const rand::rnrg_benchmark& benchmark)
+    {
+        return benchmark.compute_homogeneous_byte_distribution_index || benchmark.compute_integer_uniqueness_index;
+    }
+
     static std::string range_size_str_(std::size_t range_size)
     {
         if (range_size >= one_Gb)
@@ -65,8 +82,10 @@ private:
                               << bm_res.homogeneous_byte_distribution_indexes[i];
                 if (benchmark.compute_integer_uniqueness_index)
                     std::cout << "  U: " << std::fixed << std::setprecision(10) << bm_res.integer_uniqueness_indexes[i];
-                std::cout << "  D(ms): " << std::fixed << std::setprecision(6) << bm_res.execution_durations[i]
-                          << "  seed(" << bm_res.seeds[i].name() << ")" << std::endl;
+                std::cout << "  D(ms): " << std::fixed << std::setprecision(6) << bm_res.execution_durations[i];
+                if (has_indexes_(benchmark))
+                    std::cout << "  M(ms): " << std::fixed << std::setprecision(6) << bm_res.measurement_durations[i];
+                std::cout << "  seed(" << bm_res.seeds[i].name() << ")" << std::endl;
             }
             std::cout << "    ----------" << std::endl;
         }
@@ -77,8 +96,23 @@ private:
         ;
         if (benchmark.compute_integer_uniqueness_index)
             std::cout << "  U: " << std::fixed << std::setprecision(10) << bm_res.average_integer_uniqueness_index;
-        std::cout << "  D(ms): " << std::fixed << std::setprecision(6) << bm_res.average_execution_duration
-                  << "  Average" << std::endl;
+        std::cout << "  D(ms): " << std::fixed << std::setprecision(6) << bm_res.average_execution_duration;
+        if (has_indexes_(benchmark))
+            std::cout << "  M(ms): " << std::fixed << std::setprecision(6) << bm_res.average_measurement_duration;
+        std::cout << "  Average" << std::endl;
+    }
+
+    static void print_statistical_test_results_(std::string_view title, auto const& bm_res)
+    {
+        std::cout << "## " << title << "  M(ms): " << std::fixed << std::setprecision(3)
+                  << bm_res.average_measurement_duration << std::endl;
+        for (const rand::statistical_test test : rand::statistical_tests)
+        {
+            std::cout << std::format("    {:<20}", rand::to_string(test));
+            for (const rand::statistical_test_result& result : bm_res.results_of(test))
+                std::cout << std::format("  {:>14.6f} p={:.4f}", result.statistic, result.p_value);
+            std::cout << std::endl;
+        }
     }
 
     void print_header_(const rand::rnrg_benchmark& benchmark, std::size_t nb_bytes,
@@ -112,6 +146,80 @@ public:
                 benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
             print_benchmark_result_("rand::xoron64_range_engine<> seq", benchmark, bm_res, false);
         }
+        {
+            using random_number_range_generator_t = rand::xoron64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::xoron64_range_engine<> par", benchmark, bm_res, false);
+        }
+        {
+            rand::rnrg_benchmark approximate_benchmark;
+            approximate_benchmark.approximate_integer_uniqueness_index = true;
+            using random_number_range_generator_t = rand::xoron64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                approximate_benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::xoron64_range_engine<> par, approximate U", approximate_benchmark, bm_res,
+                                    false);
+        }
+    }
+
+    // Indexes of all the seeds, measured at the same time within the default memory budget.
+    void benchmark_HU__1Go_parallel_seeds(std::size_t nb_seeds = rand::bit_balanced_uint64s::enumerators.size())
+    {
+        constexpr std::size_t nb_bytes = one_Gb + 7;
+        constexpr auto endianness_policy = cppx::endianness_neutral;
+        const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(nb_seeds);
+        rand::rnrg_benchmark benchmark;
+        benchmark.parallel_seeds = true;
+
+        print_header_(benchmark, nb_bytes, endianness_policy, nb_seeds);
+        using random_number_range_generator_t = rand::xoron64_range_engine<>;
+        random_number_range_generator_t rnrg;
+        const auto start_time_point = std::chrono::steady_clock::now();
+        const rand::rnrg_benchmark_result bm_res =
+            benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time_point;
+        print_benchmark_result_("rand::xoron64_range_engine<> par, parallel seeds", benchmark, bm_res);
+        std::cout << "    total(s): " << std::fixed << std::setprecision(3) << duration.count() << std::endl;
+    }
+
+    // p-values of the statistical tests for each seed: a few ones below 0.01 are expected, many ones reveal a weakness.
+    void benchmark_statistical_tests__64Mo(std::size_t nb_seeds = 4)
+    {
+        constexpr std::size_t nb_bytes = 64 * one_Mb;
+        constexpr auto endianness_policy = cppx::endianness_specific;
+        const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(nb_seeds);
+        rand::rnrg_benchmark benchmark{ false, false };
+        benchmark.compute_statistical_tests(true);
+
+        std::cout << "----------------------------------------------------------------------" << std::endl;
+        std::cout << std::format("# statistical tests - ({}, {}) - nb_seeds={}", range_size_str_(nb_bytes),
+                                 endianness_str_(endianness_policy), nb_seeds)
+                  << std::endl;
+        {
+            rand::xorshift64_range_engine<> rnrg;
+            print_statistical_test_results_("rand::xorshift64_range_engine<>",
+                                            benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy));
+        }
+        {
+            rand::xoron64_range_engine<> rnrg;
+            print_statistical_test_results_(
+                "rand::xoron64_range_engine<> par",
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par));
+        }
+        {
+            rand::xoshiro256ss_range_engine<> rnrg;
+            print_statistical_test_results_("rand::xoshiro256ss_range_engine<>",
+                                            benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy));
+        }
+        {
+            rand::chacha_range_engine<> rnrg;
+            print_statistical_test_results_(
+                "rand::chacha_range_engine<> par",
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par));
+        }
     }
 
 private:
@@ -126,6 +234,13 @@ private:
             const rand::rnrg_benchmark_result bm_res = benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy);
             print_benchmark_result_("rand::xorshift64_range_engine<>", benchmark, bm_res);
         }
+        {
+            using random_number_range_generator_t = rand::xorshift64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::xorshift64_range_engine<> par", benchmark, bm_res);
+        }
         {
             using random_number_range_generator_t = rand::xoron64_range_engine<>;
             random_number_range_generator_t rnrg;
@@ -140,6 +255,131 @@ private:
                 benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
             print_benchmark_result_("rand::xoron64_range_engine<> par", benchmark, bm_res);
         }
+        // Cost of security: the cryptographically secure engines.
+        {
+            using random_number_range_generator_t = rand::chacha_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::chacha_range_engine<> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::chacha_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::chacha_range_engine<> par", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::chacha_range_engine<8>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::chacha_range_engine<8> seq", benchmark, bm_res);
+        }
+        {
+            // Previous schedule of xoron64_fill, each expansion step reading the whole generated prefix twice.
+            using random_number_range_generator_t =
+                rand::xoron64_range_engine<rand::xorshift64_range_engine<>, 2048, 0xA6B6C6D6A6B6C6A6ull,
+                                           0x6A6B6C6D6A6B6C6Aull, 0>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::xoron64_range_engine<> untiled seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::xoshiro256ss_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::xoshiro256ss_range_engine<> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::xoshiro256ss_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::xoshiro256ss_range_engine<> par", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::xoroshiro128plus_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::xoroshiro128plus_range_engine<> seq", benchmark, bm_res);
+        }
+#ifdef __SIZEOF_INT128__
+        {
+            using random_number_range_generator_t = rand::urng_range_engine<rand::pcg64_engine>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::urng_range_engine<pcg64_engine> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::urng_range_engine<rand::pcg64_dxsm_engine>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::urng_range_engine<pcg64_dxsm_engine> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::urng_range_engine<rand::pcg64_dxsm_engine>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::urng_range_engine<pcg64_dxsm_engine> par", benchmark, bm_res);
+        }
+#endif
+        {
+            using random_number_range_generator_t = rand::threefry2x64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::threefry2x64_range_engine<> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::threefry2x64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::threefry2x64_range_engine<> par", benchmark, bm_res);
+        }
+        const auto seeds32 = rand::bit_balanced_uint32s::enumerators | std::views::take(nb_seeds);
+        {
+            using random_number_range_generator_t = rand::xorshift32_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res = benchmark.compute(rnrg, seeds32, nb_bytes, endianness_policy);
+            print_benchmark_result_("rand::xorshift32_range_engine<>", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::xoron32_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds32, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::xoron32_range_engine<> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::xoron32_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds32, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::xoron32_range_engine<> par", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::philox4x32_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds32, nb_bytes, endianness_policy, std::execution::seq);
+            print_benchmark_result_("rand::philox4x32_range_engine<> seq", benchmark, bm_res);
+        }
+        {
+            using random_number_range_generator_t = rand::philox4x32_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res =
+                benchmark.compute(rnrg, seeds32, nb_bytes, endianness_policy, std::execution::par);
+            print_benchmark_result_("rand::philox4x32_range_engine<> par", benchmark, bm_res);
+        }
     }
 
 public:
@@ -151,6 +391,149 @@ public:
         benchmark_(benchmark, nb_bytes, endianness_policy, nb_seeds);
     }
 
+    void benchmark_D__1Go_per_simd_isa(cppx::EndiannessPolicy auto endianness_policy,
+                                       std::size_t nb_seeds = rand::bit_balanced_uint64s::enumerators.size())
+    {
+        constexpr std::size_t nb_bytes = one_Gb + 7;
+        const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(nb_seeds);
+        const rand::rnrg_benchmark benchmark{ false, false };
+        const rand::simd_isa max_isa = rand::max_simd_isa();
+
+        print_header_(benchmark, nb_bytes, endianness_policy, nb_seeds);
+        double scalar_duration = std::numeric_limits<double>::quiet_NaN();
+        for (rand::simd_isa isa : { rand::simd_isa::scalar, rand::simd_isa::avx2, rand::simd_isa::avx512 })
+        {
+            if (isa > rand::detected_simd_isa())
+            {
+                std::cout << "## rand::xorshift64_range_engine<> " << rand::to_string(isa) << std::endl;
+                std::cout << "    not supported by this CPU" << std::endl;
+                continue;
+            }
+            rand::set_max_simd_isa(isa);
+            using random_number_range_generator_t = rand::xorshift64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res = benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy);
+            print_benchmark_result_(std::format("rand::xorshift64_range_engine<> {}", rand::to_string(isa)), benchmark,
+                                    bm_res);
+            if (isa == rand::simd_isa::scalar)
+                scalar_duration = bm_res.average_execution_duration;
+            std::cout << "    speedup: " << std::fixed << std::setprecision(2)
+                      << scalar_duration / bm_res.average_execution_duration << "x" << std::endl;
+        }
+        double xoron64_scalar_duration = std::numeric_limits<double>::quiet_NaN();
+        for (rand::simd_isa isa : { rand::simd_isa::scalar, rand::simd_isa::avx2, rand::simd_isa::avx512 })
+        {
+            if (isa > rand::detected_simd_isa())
+            {
+                std::cout << "## rand::xoron64_range_engine<> " << rand::to_string(isa) << std::endl;
+                std::cout << "    not supported by this CPU" << std::endl;
+                continue;
+            }
+            rand::set_max_simd_isa(isa);
+            using random_number_range_generator_t = rand::xoron64_range_engine<>;
+            random_number_range_generator_t rnrg;
+            const rand::rnrg_benchmark_result bm_res = benchmark.compute(rnrg, seeds, nb_bytes, endianness_policy);
+            print_benchmark_result_(std::format("rand::xoron64_range_engine<> {}", rand::to_string(isa)), benchmark,
+                                    bm_res);
+            if (isa == rand::simd_isa::scalar)
+                xoron64_scalar_duration = bm_res.average_execution_duration;
+            std::cout << "    speedup: " << std::fixed << std::setprecision(2)
+                      << xoron64_scalar_duration / bm_res.average_execution_duration << "x" << std::endl;
+        }
+        rand::set_max_simd_isa(max_isa);
+    }
+
+    // In-memory xoron64 against the streaming one, whose working set is a single window of 4Mb.
+    void benchmark_stream__4Go()
+    {
+        std::cout << "----------------------------------------------------------------------" << std::endl;
+        std::cout << "# xoron64 stream" << std::endl;
+        auto print_throughput = [](std::string_view title, std::size_t nb_bytes, auto generate_fn)
+        {
+            const auto start_time_point = std::chrono::steady_clock::now();
+            generate_fn();
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time_point;
+            std::cout << "## " << title << " (" << range_size_str_(nb_bytes) << ")" << std::endl;
+            std::cout << "    D(ms): " << std::fixed << std::setprecision(6) << duration.count() * 1000.
+                      << "  GB/s: " << std::setprecision(3) << nb_bytes / duration.count() / 1e9 << std::endl;
+        };
+
+        {
+            std::vector<std::byte> bytes(one_Gb);
+            rand::xoron64_range_engine<> xoron64_rnrg(42);
+            print_throughput("rand::xoron64_range_engine<> in memory", bytes.size(),
+                             [&] { xoron64_rnrg(std::span(bytes), cppx::endianness_specific); });
+            print_throughput("rand::xoron64_range_engine<> in memory par", bytes.size(),
+                             [&] { xoron64_rnrg(std::span(bytes), cppx::endianness_specific, std::execution::par); });
+            rand::xoron64_stream_engine<> xoron64_stream_rnrg(42);
+            print_throughput("rand::xoron64_stream_engine<> in memory", bytes.size(),
+                             [&] { xoron64_stream_rnrg(std::span(bytes), cppx::endianness_specific); });
+        }
+        for (std::size_t nb_bytes : { one_Gb, 4 * one_Gb })
+        {
+            rand::xoron64_stream_engine<> xoron64_stream_rnrg(42);
+            std::byte checksum{ 0 };
+            print_throughput("rand::xoron64_stream_engine<> to sink", nb_bytes,
+                             [&]
+                             {
+                                 xoron64_stream_rnrg.generate(
+                                     nb_bytes, [&](std::span<const std::byte> bytes) { checksum ^= bytes.back(); },
+                                     cppx::endianness_specific);
+                             });
+            volatile std::byte sink = checksum;
+            (void)sink;
+        }
+    }
+
+    void benchmark_reals__1Go()
+    {
+        constexpr std::size_t nb_bytes = one_Gb;
+        std::vector<double> doubles(nb_bytes / sizeof(double));
+        std::vector<float> floats(nb_bytes / sizeof(float));
+
+        std::cout << "----------------------------------------------------------------------" << std::endl;
+        std::cout << std::format("# rand_reals - ({})", range_size_str_(nb_bytes)) << std::endl;
+        auto print_throughput = [](std::string_view title, auto generate_fn)
+        {
+            const auto start_time_point = std::chrono::steady_clock::now();
+            generate_fn();
+            const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time_point;
+            std::cout << "## " << title << std::endl;
+            std::cout << "    D(ms): " << std::fixed << std::setprecision(6) << duration.count() * 1000.
+                      << "  GB/s: " << std::setprecision(3) << nb_bytes / duration.count() / 1e9 << std::endl;
+        };
+
+        rand::xorshift64_range_engine<> xorshift64_rnrg(42);
+        print_throughput("rand_doubles [0, 1) rand::xorshift64_range_engine<>",
+                         [&] { rand::rand_doubles(std::span(doubles), xorshift64_rnrg); });
+        print_throughput("rand_doubles [0, 1) rand::xorshift64_range_engine<> par",
+                         [&] {
+                             rand::rand_doubles(std::span(doubles), xorshift64_rnrg, rand::unit_interval::closed_open,
+                                                std::execution::par);
+                         });
+        print_throughput("rand_doubles (0, 1] rand::xorshift64_range_engine<>",
+                         [&] {
+                             rand::rand_doubles(std::span(doubles), xorshift64_rnrg, rand::unit_interval::open_closed);
+                         });
+        print_throughput("rand_doubles [-10, 10) rand::xorshift64_range_engine<>",
+                         [&] { rand::rand_doubles(std::span(doubles), -10., 10., xorshift64_rnrg); });
+        print_throughput("rand_floats [0, 1) rand::xorshift64_range_engine<>",
+                         [&] { rand::rand_floats(std::span(floats), xorshift64_rnrg); });
+        print_throughput("rand_floats [-10, 10) rand::xorshift64_range_engine<>",
+                         [&] { rand::rand_floats(std::span(floats), -10.f, 10.f, xorshift64_rnrg); });
+
+        rand::xoron64_range_engine<> xoron64_rnrg(42);
+        print_throughput("rand_doubles [0, 1) rand::xoron64_range_engine<>",
+                         [&] { rand::rand_doubles(std::span(doubles), xoron64_rnrg); });
+        print_throughput("rand_doubles [0, 1) rand::xoron64_range_engine<> par",
+                         [&] {
+                             rand::rand_doubles(std::span(doubles), xoron64_rnrg, rand::unit_interval::closed_open,
+                                                std::execution::par);
+                         });
+        print_throughput("rand_floats [0, 1) rand::xoron64_range_engine<>",
+                         [&] { rand::rand_floats(std::span(floats), xoron64_rnrg); });
+    }
+
     void benchmark_HUD__1Mo(cppx::EndiannessPolicy auto endianness_policy,
                             std::size_t nb_seeds = rand::bit_balanced_uint64s::enumerators.size())
     {
@@ -164,8 +547,14 @@ int main()
 {
     benchmark_rng64s benchmark;
     benchmark.benchmark_HUD__1Go_neutral(4);
+    benchmark.benchmark_HU__1Go_parallel_seeds();
+    benchmark.benchmark_statistical_tests__64Mo();
     benchmark.benchmark_D__1Go(cppx::endianness_neutral);
     benchmark.benchmark_D__1Go(cppx::endianness_specific);
+    benchmark.benchmark_D__1Go_per_simd_isa(cppx::endianness_neutral);
+    benchmark.benchmark_D__1Go_per_simd_isa(cppx::endianness_specific);
+    benchmark.benchmark_reals__1Go();
+    benchmark.benchmark_stream__4Go();
     benchmark.benchmark_HUD__1Mo(cppx::endianness_neutral);
     benchmark.benchmark_HUD__1Mo(cppx::endianness_specific);
 
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <arba/rand/hyperloglog.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// Bijective mixers (finalizers of MurmurHash3): distinct integers have distinct mixes, whose bits all depend on the
+// bits of the integer.
+constexpr uint32_t distinct_mix_(uint32_t value)
+{
+    value = (value ^ (value >> 16)) * 0x85ebca6bu;
+    value = (value ^ (value >> 13)) * 0xc2b2ae35u;
+    return value ^ (value >> 16);
+}
+
+constexpr uint64_t distinct_mix_(uint64_t value)
+{
+    value = (value ^ (value >> 33)) * 0xff51afd7ed558ccdull;
+    value = (value ^ (value >> 33)) * 0xc4ceb9fe1a85ec53ull;
+    return value ^ (value >> 33);
+}
+
+// Number of distinct mixes, inserted in an open addressing table of at least twice their number, reused by the calls
+// of the thread. 0 marks the empty slots: it is counted apart.
+template <std::unsigned_integral WordT>
+std::size_t count_distinct_mixes_(std::span<const WordT> mixes)
+{
+    static thread_local std::vector<WordT> table;
+    const std::size_t table_size = std::bit_ceil(std::max<std::size_t>(2 * mixes.size(), 16));
+    table.assign(table_size, 0);
+
+    const std::size_t mask = table_size - 1;
+    std::size_t count = 0;
+    bool has_zero = false;
+    for (const WordT mix : mixes)
+    {
+        if (mix == 0) [[unlikely]]
+        {
+            has_zero = true;
+            continue;
+        }
+        for (std::size_t slot = std::size_t(mix) & mask;; slot = (slot + 1) & mask)
+        {
+            if (table[slot] == mix)
+                break;
+            if (table[slot] == 0)
+            {
+                table[slot] = mix;
+                ++count;
+                break;
+            }
+        }
+    }
+    return count + has_zero;
+}
+
+} // namespace private_
+
+// Type of the scratch buffer of count_distinct: the mixes of the integers.
+template <std::integral IntType>
+using distinct_mix_t = std::conditional_t<sizeof(IntType) <= sizeof(uint32_t), uint32_t, uint64_t>;
+
+// Number of distinct integers, in linear time (std::sort and std::unique take O(n log n)), without modifying them.
+// Their mixes are partitioned by their high bits in the scratch buffer (at least as large as ints, unused for integers
+// of 16 bits or less), in buckets of about 32K integers counted with a hash table fitting in the L2 cache. Both steps
+// are distributed with the execution policy.
+template <std::integral IntType>
+std::size_t count_distinct(std::span<const IntType> ints, std::span<distinct_mix_t<IntType>> scratch,
+                           cppx::ExecutionPolicy auto execution_policy)
+{
+    using word_type = std::make_unsigned_t<IntType>;
+
+    if constexpr (sizeof(word_type) <= sizeof(uint16_t))
+    {
+        std::vector<bool> found(std::size_t(1) << (8 * sizeof(word_type)), false);
+        std::size_t count = 0;
+        for (const IntType value : ints)
+        {
+            if (!found[word_type(value)])
+            {
+                found[word_type(value)] = true;
+                ++count;
+            }
+        }
+        return count;
+    }
+    else
+    {
+        using mix_type = distinct_mix_t<IntType>;
+        constexpr std::size_t bucket_size = 32 * 1024;
+        constexpr std::size_t chunk_size = 1024 * 1024;
+        constexpr std::size_t max_nb_chunks = 64;
+        constexpr bool is_sequenced =
+            std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>;
+
+        const std::size_t nb_ints = ints.size();
+        assert(scratch.size() >= nb_ints);
+        const unsigned bucket_bits = std::min<unsigned>(std::bit_width(nb_ints / bucket_size), 16);
+        const std::size_t nb_buckets = std::size_t(1) << bucket_bits;
+        const auto bucket_of = [bucket_bits](mix_type mix) -> std::size_t
+        { return bucket_bits == 0 ? 0 : mix >> (8 * sizeof(mix_type) - bucket_bits); };
+        const auto mix_of = [](IntType value) { return private_::distinct_mix_(mix_type(word_type(value))); };
+
+        // Counting sort of the mixes by bucket: histogram of each chunk (at most max_nb_chunks, to bound the memory of
+        // the histograms), then scatter at the offsets of the chunk.
+        const std::size_t nb_chunks =
+            is_sequenced ? 1 : std::clamp<std::size_t>((nb_ints + chunk_size - 1) / chunk_size, 1, max_nb_chunks);
+        const std::size_t ints_per_chunk = (nb_ints + nb_chunks - 1) / nb_chunks;
+        std::vector<std::size_t> chunk_indexes(nb_chunks);
+        std::iota(chunk_indexes.begin(), chunk_indexes.end(), 0);
+        const auto chunk_ints = [&](std::size_t chunk_index)
+        {
+            const std::size_t offset = std::min(chunk_index * ints_per_chunk, nb_ints);
+            return ints.subspan(offset, std::min(ints_per_chunk, nb_ints - offset));
+        };
+
+        std::vector<std::size_t> offsets(nb_chunks * nb_buckets, 0);
+        std::for_each(execution_policy, chunk_indexes.cbegin(), chunk_indexes.cend(),
+                      [&](std::size_t chunk_index)
+                      {
+                          std::size_t* const chunk_offsets = offsets.data() + chunk_index * nb_buckets;
+                          for (const IntType value : chunk_ints(chunk_index))
+                              ++chunk_offsets[bucket_of(mix_of(value))];
+                      });
+
+        std::vector<std::size_t> bucket_offsets(nb_buckets + 1, 0);
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < nb_buckets; ++bucket)
+        {
+            bucket_offsets[bucket] = offset;
+            for (std::size_t chunk_index = 0; chunk_index < nb_chunks; ++chunk_index)
+                offset += std::exchange(offsets[chunk_index * nb_buckets + bucket], offset);
+        }
+        bucket_offsets[nb_buckets] = offset;
+
+        std::for_each(execution_policy, chunk_indexes.cbegin(), chunk_indexes.cend(),
+                      [&](std::size_t chunk_index)
+                      {
+                          std::size_t* const chunk_offsets = offsets.data() + chunk_index * nb_buckets;
+                          for (const IntType value : chunk_ints(chunk_index))
+                          {
+                              const mix_type mix = mix_of(value);
+                              scratch[chunk_offsets[bucket_of(mix)]++] = mix;
+                          }
+                      });
+
+        // The integers of different buckets are distinct.
+        const std::span<const mix_type> sorted_mixes = scratch.first(nb_ints);
+        std::vector<std::size_t> bucket_indexes(nb_buckets);
+        std::iota(bucket_indexes.begin(), bucket_indexes.end(), 0);
+        return std::transform_reduce(
+            execution_policy, bucket_indexes.cbegin(), bucket_indexes.cend(), std::size_t(0), std::plus<>(),
+            [&](std::size_t bucket)
+            {
+                const std::size_t first = bucket_offsets[bucket];
+                return private_::count_distinct_mixes_(sorted_mixes.subspan(first, bucket_offsets[bucket + 1] - first));
+            });
+    }
+}
+
+// Number of distinct integers, with a temporary scratch buffer.
+template <std::integral IntType>
+std::size_t count_distinct(std::span<const IntType> ints, cppx::ExecutionPolicy auto execution_policy)
+{
+    if constexpr (sizeof(IntType) <= sizeof(uint16_t))
+        return count_distinct(ints, std::span<distinct_mix_t<IntType>>(), execution_policy);
+    else
+    {
+        const std::unique_ptr scratch = std::make_unique_for_overwrite<distinct_mix_t<IntType>[]>(ints.size());
+        return count_distinct(ints, std::span(scratch.get(), ints.size()), execution_policy);
+    }
+}
+
+template <std::integral IntType>
+std::size_t count_distinct(std::span<const IntType> ints)
+{
+    return count_distinct(ints, std::execution::seq);
+}
+
+// Estimation of the number of distinct integers, in one pass without memory proportional to their number: the
+// sketches of chunks of ints are filled with the execution policy, then merged.
+template <unsigned Precision = 16, std::integral IntType>
+std::size_t approximate_count_distinct(std::span<const IntType> ints, cppx::ExecutionPolicy auto execution_policy)
+{
+    using word_type = std::make_unsigned_t<IntType>;
+    constexpr std::size_t chunk_size = 16 * 1024 * 1024;
+    constexpr std::size_t max_nb_chunks = 64;
+    constexpr bool is_sequenced =
+        std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>;
+
+    const std::size_t nb_chunks =
+        is_sequenced ? 1 : std::clamp<std::size_t>((ints.size() + chunk_size - 1) / chunk_size, 1, max_nb_chunks);
+    const std::size_t ints_per_chunk = (ints.size() + nb_chunks - 1) / nb_chunks;
+    std::vector<hyperloglog<Precision>> sketches(nb_chunks);
+    std::vector<std::size_t> chunk_indexes(nb_chunks);
+    std::iota(chunk_indexes.begin(), chunk_indexes.end(), 0);
+    std::for_each(execution_policy, chunk_indexes.cbegin(), chunk_indexes.cend(),
+                  [&](std::size_t chunk_index)
+                  {
+                      const std::size_t offset = std::min(chunk_index * ints_per_chunk, ints.size());
+                      for (const IntType value : ints.subspan(offset, std::min(ints_per_chunk, ints.size() - offset)))
+                          sketches[chunk_index].insert(private_::distinct_mix_(uint64_t(word_type(value))));
+                  });
+
+    for (std::size_t chunk_index = 1; chunk_index < nb_chunks; ++chunk_index)
+        sketches.front().merge(sketches[chunk_index]);
+    return std::size_t(std::llround(sketches.front().estimate()));
+}
+
+template <unsigned Precision = 16, std::integral IntType>
+std::size_t approximate_count_distinct(std::span<const IntType> ints)
+{
+    return approximate_count_distinct<Precision>(ints, std::execution::seq);
+}
+
+} // namespace rand
+} // namespace arba
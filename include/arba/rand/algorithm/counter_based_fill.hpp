@@ -0,0 +1,174 @@
+#pragma once
+
+#include <arba/rand/philox.hpp>
+#include <arba/rand/simd/counter_based_kernels.hpp>
+#include <arba/rand/threefry.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// Counter-based generators: value i is the word i % block_size of the block generated for the counter of block
+// i / block_size. The block index is the low 64 bits of the counter, the other bits are 0.
+
+template <unsigned Rounds>
+struct philox4x32_generator_
+{
+    using word_type = uint32_t;
+    using key_type = philox4x32_key;
+    using block_type = philox4x32_counter;
+    static constexpr std::size_t block_size = 4;
+
+    static constexpr block_type block(uint64_t block_index, const key_type& key)
+    {
+        return philox4x32<Rounds>({ uint32_t(block_index), uint32_t(block_index >> 32), 0, 0 }, key);
+    }
+
+    static constexpr key_type key_from_seed(uint64_t seed) { return { uint32_t(seed), uint32_t(seed >> 32) }; }
+
+    static std::size_t blocks_simd(uint64_t first_block_index, const key_type& key, std::span<word_type> words,
+                                   cppx::EndiannessPolicy auto ep)
+    {
+        return philox4x32_blocks_simd_<Rounds>(first_block_index, key, words, ep);
+    }
+};
+
+template <unsigned Rounds>
+struct threefry2x64_generator_
+{
+    using word_type = uint64_t;
+    using key_type = threefry2x64_key;
+    using block_type = threefry2x64_counter;
+    static constexpr std::size_t block_size = 2;
+
+    static constexpr block_type block(uint64_t block_index, const key_type& key)
+    {
+        return threefry2x64<Rounds>({ block_index, 0 }, key);
+    }
+
+    static constexpr key_type key_from_seed(uint64_t seed) { return { seed, 0 }; }
+
+    static std::size_t blocks_simd(uint64_t first_block_index, const key_type& key, std::span<word_type> words,
+                                   cppx::EndiannessPolicy auto ep)
+    {
+        return threefry2x64_blocks_simd_<Rounds>(first_block_index, key, words, ep);
+    }
+};
+
+// Writes the values first_index, first_index + 1... in words: a partial block at each end, whole blocks in the
+// middle, with the SIMD kernel of the active instruction set for the bulk of them.
+template <class GeneratorT>
+void counter_based_fill_words_(std::span<typename GeneratorT::word_type> words,
+                               const typename GeneratorT::key_type& key, uint64_t first_index,
+                               cppx::EndiannessPolicy auto ep)
+{
+    constexpr std::size_t block_size = GeneratorT::block_size;
+
+    const auto copy_block_part = [&](uint64_t block_index, std::size_t first, std::size_t count)
+    {
+        const auto block = GeneratorT::block(block_index, key);
+        for (std::size_t i = 0; i < count; ++i)
+            words[i] = core::htow_when(block[first + i], ep);
+        words = words.subspan(count);
+    };
+
+    uint64_t block_index = first_index / block_size;
+    if (const std::size_t first = first_index % block_size; first != 0 && !words.empty())
+        copy_block_part(block_index++, first, std::min(block_size - first, words.size()));
+
+    const std::size_t nb_blocks = words.size() / block_size;
+    std::size_t i = GeneratorT::blocks_simd(block_index, key, words.first(nb_blocks * block_size), ep) / block_size;
+    for (; i < nb_blocks; ++i)
+    {
+        const auto block = GeneratorT::block(block_index + i, key);
+        for (std::size_t k = 0; k < block_size; ++k)
+            words[i * block_size + k] = core::htow_when(block[k], ep);
+    }
+    words = words.subspan(nb_blocks * block_size);
+
+    if (!words.empty())
+        copy_block_part(block_index + nb_blocks, 0, words.size());
+}
+
+// Fills bytes with the values first_index, first_index + 1... then the first bytes of the next value when the size
+// is not a multiple of the word size. The blocks do not depend on each other: the bytes are cut into chunks of 1 MiB
+// distributed with the execution policy, and the output does not depend on it.
+template <class GeneratorT>
+std::span<std::byte> counter_based_fill_(const std::span<std::byte> bytes, const typename GeneratorT::key_type& key,
+                                         uint64_t first_index, cppx::EndiannessPolicy auto ep,
+                                         cppx::ExecutionPolicy auto execution_policy)
+{
+    using word_type = typename GeneratorT::word_type;
+    constexpr std::size_t chunk_size = (1024 * 1024) / sizeof(word_type);
+
+    const std::span words = core::as_writable_span<word_type>(bytes);
+    const std::size_t nb_chunks = (words.size() + chunk_size - 1) / chunk_size;
+    if (nb_chunks <= 1
+        || std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>)
+        counter_based_fill_words_<GeneratorT>(words, key, first_index, ep);
+    else
+    {
+        std::vector<std::size_t> chunk_indexes(nb_chunks);
+        std::iota(chunk_indexes.begin(), chunk_indexes.end(), 0);
+        std::for_each(execution_policy, chunk_indexes.cbegin(), chunk_indexes.cend(),
+                      [&](std::size_t chunk_index)
+                      {
+                          const std::size_t offset = chunk_index * chunk_size;
+                          counter_based_fill_words_<GeneratorT>(
+                              words.subspan(offset, std::min(chunk_size, words.size() - offset)), key,
+                              first_index + offset, ep);
+                      });
+    }
+
+    if (const std::size_t remaining_bytes = bytes.size() % sizeof(word_type); remaining_bytes > 0)
+    {
+        const uint64_t index = first_index + words.size();
+        const auto block = GeneratorT::block(index / GeneratorT::block_size, key);
+        word_type value = core::htow_when(block[index % GeneratorT::block_size], ep);
+        std::ranges::copy(core::as_writable_bytes(value).first(remaining_bytes), bytes.last(remaining_bytes).begin());
+    }
+    return bytes;
+}
+
+} // namespace private_
+
+// Fills bytes with the Philox4x32 values of the key from first_index on: value i is the word i % 4 of
+// philox4x32<Rounds>({ low and high halves of i / 4, 0, 0 }, key).
+template <unsigned Rounds = 10>
+std::span<std::byte> philox4x32_fill(const std::span<std::byte> bytes, const philox4x32_key& key,
+                                     uint64_t first_index, cppx::EndiannessPolicy auto ep,
+                                     cppx::ExecutionPolicy auto execution_policy)
+{
+    return private_::counter_based_fill_<private_::philox4x32_generator_<Rounds>>(bytes, key, first_index, ep,
+                                                                                  execution_policy);
+}
+
+// Fills bytes with the Threefry2x64 values of the key from first_index on: value i is the word i % 2 of
+// threefry2x64<Rounds>({ i / 2, 0 }, key).
+template <unsigned Rounds = 20>
+std::span<std::byte> threefry2x64_fill(const std::span<std::byte> bytes, const threefry2x64_key& key,
+                                       uint64_t first_index, cppx::EndiannessPolicy auto ep,
+                                       cppx::ExecutionPolicy auto execution_policy)
+{
+    return private_::counter_based_fill_<private_::threefry2x64_generator_<Rounds>>(bytes, key, first_index, ep,
+                                                                                    execution_policy);
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/ziggurat.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <span>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Fills doubles with exponential values of rate lambda, with the ziggurat method fed by the bulk output of the range
+// engine (the execution policy only applies to the engine).
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_exponentials(std::span<double> doubles, double lambda, RnrgT& rnrg,
+                                    cppx::ExecutionPolicy auto execution_policy)
+{
+    return private_::ziggurat_fill_<private_::ziggurat_exponential_>(doubles, rnrg, 0., 1. / lambda,
+                                                                     execution_policy);
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_exponentials(std::span<double> doubles, double lambda, RnrgT& rnrg)
+{
+    return rand_exponentials(doubles, lambda, rnrg, std::execution::seq);
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_exponentials(std::span<double> doubles, RnrgT& rnrg,
+                                    cppx::ExecutionPolicy auto execution_policy)
+{
+    return rand_exponentials(doubles, 1., rnrg, execution_policy);
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_exponentials(std::span<double> doubles, RnrgT& rnrg)
+{
+    return rand_exponentials(doubles, 1., rnrg, std::execution::seq);
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <type_traits>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+template <std::integral IntType>
+using rand_ints_word_t_ = std::conditional_t<(sizeof(IntType) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+// Number of words mapped at once: the rejection count and the mapping passes run over a block still in L1.
+inline constexpr std::size_t rand_ints_block_size_ = 256;
+
+// Number of words generated at once when the integers are smaller than the words.
+inline constexpr std::size_t rand_ints_chunk_size_ = 4096;
+
+// Maps each word to [min, min + range] with Lemire's multiply-high. A block is first scanned for words in the biased
+// zone (low half of the product below 2^digits mod (range + 1)): when there is none, which is by far the most common
+// case, the block is mapped by a branchless loop; otherwise its rejected words are redrawn from the word source.
+// words and ints may share the same memory.
+template <std::integral IntType, std::unsigned_integral WordT, class WordSourceT>
+void map_words_to_ints_(std::span<const WordT> words, std::span<IntType> ints, IntType min, WordT range,
+                        WordSourceT& word_source)
+{
+    using uint_t = std::make_unsigned_t<IntType>;
+    const uint_t umin = static_cast<uint_t>(min);
+    assert(words.size() == ints.size());
+
+    if (range == std::numeric_limits<WordT>::max())
+    {
+        std::ranges::transform(words, ints.begin(), [=](WordT word) { return static_cast<IntType>(umin + word); });
+        return;
+    }
+
+    if constexpr (requires { typename wide_uint_<WordT>::type; })
+    {
+        using wide_t = typename wide_uint_<WordT>::type;
+        constexpr unsigned digits = std::numeric_limits<WordT>::digits;
+        const WordT bound = range + 1;
+        const WordT threshold = static_cast<WordT>(-bound) % bound;
+
+        for (std::size_t offset = 0; offset < words.size(); offset += rand_ints_block_size_)
+        {
+            const std::size_t count = std::min(rand_ints_block_size_, words.size() - offset);
+            const WordT* block_words = words.data() + offset;
+            IntType* block_ints = ints.data() + offset;
+
+            std::size_t nb_rejected = 0;
+            if (threshold != 0)
+                for (std::size_t i = 0; i < count; ++i)
+                    nb_rejected += static_cast<WordT>(wide_t(block_words[i]) * bound) < threshold;
+
+            if (nb_rejected == 0) [[likely]]
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    block_ints[i] = static_cast<IntType>(
+                        umin + static_cast<uint_t>((wide_t(block_words[i]) * bound) >> digits));
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    wide_t product = wide_t(block_words[i]) * bound;
+                    while (static_cast<WordT>(product) < threshold)
+                        product = wide_t(word_source()) * bound;
+                    block_ints[i] = static_cast<IntType>(umin + static_cast<uint_t>(product >> digits));
+                }
+            }
+        }
+    }
+    else
+    {
+        uniform_int_distribution<WordT> distribution(0, range);
+        std::ranges::transform(words, ints.begin(),
+                               [&](WordT) { return static_cast<IntType>(umin + distribution(word_source)); });
+    }
+}
+
+} // namespace private_
+
+// Fills ints with uniform values in [min, max].
+template <std::integral IntType, std::uniform_random_bit_generator UrngT>
+std::span<IntType> rand_ints(std::span<IntType> ints, std::type_identity_t<IntType> min,
+                             std::type_identity_t<IntType> max, UrngT& rng)
+{
+    assert(min <= max);
+    uniform_int_distribution<IntType> distribution(min, max);
+    std::ranges::generate(ints, [&] { return distribution(rng); });
+    return ints;
+}
+
+// Fills ints with uniform values in [min, max]: raw words are generated in bulk by the range engine with the
+// execution policy, directly in ints when the integers are words and else in chunks of 4096 words, then mapped to
+// the interval block by block.
+template <std::integral IntType, RandomNumberRangeGenerator RnrgT>
+std::span<IntType> rand_ints(std::span<IntType> ints, std::type_identity_t<IntType> min,
+                             std::type_identity_t<IntType> max, RnrgT& rnrg,
+                             cppx::ExecutionPolicy auto execution_policy)
+{
+    using word_t = private_::rand_ints_word_t_<IntType>;
+    using uint_t = std::make_unsigned_t<IntType>;
+
+    assert(min <= max);
+    const word_t range = static_cast<uint_t>(static_cast<uint_t>(max) - static_cast<uint_t>(min));
+    private_::rnrg_word_source_<word_t, RnrgT> word_source(rnrg);
+
+    if constexpr (sizeof(IntType) == sizeof(word_t))
+    {
+        private_::rnrg_fill_(rnrg, std::as_writable_bytes(ints), execution_policy);
+        const std::span words = core::as_writable_span<word_t>(std::as_writable_bytes(ints));
+        private_::map_words_to_ints_<IntType, word_t>(words, ints, min, range, word_source);
+    }
+    else
+    {
+        std::array<word_t, private_::rand_ints_chunk_size_> buffer;
+        for (std::size_t offset = 0; offset < ints.size(); offset += buffer.size())
+        {
+            const std::span chunk_ints = ints.subspan(offset, std::min(buffer.size(), ints.size() - offset));
+            const std::span words = std::span(buffer).first(chunk_ints.size());
+            private_::rnrg_fill_(rnrg, std::as_writable_bytes(words), execution_policy);
+            private_::map_words_to_ints_<IntType, word_t>(words, chunk_ints, min, range, word_source);
+        }
+    }
+    return ints;
+}
+
+template <std::integral IntType, RandomNumberRangeGenerator RnrgT>
+std::span<IntType> rand_ints(std::span<IntType> ints, std::type_identity_t<IntType> min,
+                             std::type_identity_t<IntType> max, RnrgT& rnrg)
+{
+    return rand_ints(ints, min, max, rnrg, std::execution::seq);
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/ziggurat.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <span>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Fills doubles with normal values of the given mean and standard deviation, with the ziggurat method fed by the
+// bulk output of the range engine (the execution policy only applies to the engine).
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_normals(std::span<double> doubles, double mean, double stddev, RnrgT& rnrg,
+                               cppx::ExecutionPolicy auto execution_policy)
+{
+    return private_::ziggurat_fill_<private_::ziggurat_normal_>(doubles, rnrg, mean, stddev, execution_policy);
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_normals(std::span<double> doubles, double mean, double stddev, RnrgT& rnrg)
+{
+    return rand_normals(doubles, mean, stddev, rnrg, std::execution::seq);
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_normals(std::span<double> doubles, RnrgT& rnrg, cppx::ExecutionPolicy auto execution_policy)
+{
+    return rand_normals(doubles, 0., 1., rnrg, execution_policy);
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<double> rand_normals(std::span<double> doubles, RnrgT& rnrg)
+{
+    return rand_normals(doubles, 0., 1., rnrg, std::execution::seq);
+}
+
+} // namespace rand
+} // namespace arba
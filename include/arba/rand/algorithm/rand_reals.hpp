@@ -0,0 +1,127 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Interval of the values generated by rand_reals() when no bounds are given.
+enum class unit_interval : uint8_t
+{
+    closed_open, // [0, 1)
+    open_closed, // (0, 1]
+};
+
+namespace private_
+{
+
+template <std::floating_point RealT>
+    requires(std::numeric_limits<RealT>::is_iec559)
+struct real_traits_;
+
+template <>
+struct real_traits_<float>
+{
+    using uint_type = uint32_t;
+};
+
+template <>
+struct real_traits_<double>
+{
+    using uint_type = uint64_t;
+};
+
+// Mantissa trick: the high bits of the word become the mantissa of a real with the exponent of 1, which gives a
+// uniform value in [1, 2) with the full precision of the type, without any conversion or division.
+template <std::floating_point RealT>
+constexpr RealT one_to_two_(typename real_traits_<RealT>::uint_type word)
+{
+    using uint_t = typename real_traits_<RealT>::uint_type;
+    constexpr int shift = std::numeric_limits<uint_t>::digits - (std::numeric_limits<RealT>::digits - 1);
+    constexpr uint_t one_bits = std::bit_cast<uint_t>(RealT(1));
+    return std::bit_cast<RealT>(static_cast<uint_t>((word >> shift) | one_bits));
+}
+
+// Generates the raw words in place, then converts each of them with the function. The conversion pass only goes
+// through uint_type lvalues and is a plain element-wise transform, hence vectorizable and safe to run in parallel.
+template <std::floating_point RealT, RandomNumberRangeGenerator RnrgT, class ConvertFunctionT>
+std::span<RealT> rand_reals_(std::span<RealT> reals, RnrgT& rnrg, cppx::ExecutionPolicy auto execution_policy,
+                             ConvertFunctionT convert)
+{
+    using uint_t = typename real_traits_<RealT>::uint_type;
+
+    const std::span bytes = std::as_writable_bytes(reals);
+    rnrg_fill_(rnrg, bytes, execution_policy);
+    const std::span words = core::as_writable_span<uint_t>(bytes);
+    std::transform(execution_policy, words.begin(), words.end(), words.begin(),
+                   [=](uint_t word) { return std::bit_cast<uint_t>(convert(one_to_two_<RealT>(word))); });
+    return reals;
+}
+
+} // namespace private_
+
+// Fills reals with uniform values in the unit interval, with the precision of the mantissa.
+template <std::floating_point RealT, RandomNumberRangeGenerator RnrgT>
+std::span<RealT> rand_reals(std::span<RealT> reals, RnrgT& rnrg, unit_interval interval,
+                            cppx::ExecutionPolicy auto execution_policy)
+{
+    if (interval == unit_interval::open_closed)
+        return private_::rand_reals_(reals, rnrg, execution_policy, [](RealT value) { return RealT(2) - value; });
+    return private_::rand_reals_(reals, rnrg, execution_policy, [](RealT value) { return value - RealT(1); });
+}
+
+template <std::floating_point RealT, RandomNumberRangeGenerator RnrgT>
+std::span<RealT> rand_reals(std::span<RealT> reals, RnrgT& rnrg, unit_interval interval = unit_interval::closed_open)
+{
+    return rand_reals(reals, rnrg, interval, std::execution::seq);
+}
+
+// Fills reals with uniform values in [a, b). The values rounded up to b are moved to the greatest real below b.
+template <std::floating_point RealT, RandomNumberRangeGenerator RnrgT>
+std::span<RealT> rand_reals(std::span<RealT> reals, std::type_identity_t<RealT> a, std::type_identity_t<RealT> b,
+                            RnrgT& rnrg, cppx::ExecutionPolicy auto execution_policy)
+{
+    assert(a < b);
+    const RealT scale = b - a;
+    const RealT below_b = std::nextafter(b, a);
+    return private_::rand_reals_(reals, rnrg, execution_policy,
+                                 [=](RealT value) { return std::min(a + (value - RealT(1)) * scale, below_b); });
+}
+
+template <std::floating_point RealT, RandomNumberRangeGenerator RnrgT>
+std::span<RealT> rand_reals(std::span<RealT> reals, std::type_identity_t<RealT> a, std::type_identity_t<RealT> b,
+                            RnrgT& rnrg)
+{
+    return rand_reals(reals, a, b, rnrg, std::execution::seq);
+}
+
+// rand_reals() with float.
+inline std::span<float> rand_floats(std::span<float> floats, auto&&... args)
+{
+    return rand_reals(floats, std::forward<decltype(args)>(args)...);
+}
+
+// rand_reals() with double.
+inline std::span<double> rand_doubles(std::span<double> doubles, auto&&... args)
+{
+    return rand_reals(doubles, std::forward<decltype(args)>(args)...);
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <arba/rand/algorithm/xoron_fill.hpp>
+
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Default size of the tiles of the expansion steps of xoron32_fill.
+inline constexpr std::size_t xoron32_default_tile_bytes = 64 * 1024;
+
+// 32-bit counterpart of xoron64_fill, on 32-bit words. The default masks are bit_balanced_uint32s::caac and
+// bit_balanced_uint32s::c0de.
+template <std::size_t InitRangeSize = 2048, uint32_t AlphaXorMask = 0xcaac'caac, uint32_t BetaXorMask = 0xc0de'c0de,
+          std::size_t TileBytes = xoron32_default_tile_bytes>
+std::span<std::byte> xoron32_fill(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto ep,
+                                  cppx::ExecutionPolicy auto execution_policy)
+{
+    // The odd rotations of a 32-bit word, primes first. From the default initial range of 2048 bytes, the 15 steps
+    // expand to about 27 GiB (29'326'958'408 bytes): the bytes beyond are byte-rotated copies of the first ones.
+    constexpr std::array rotations = { 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 9, 15, 21, 25, 27 };
+    return private_::xoron_fill_<uint32_t, InitRangeSize, AlphaXorMask, BetaXorMask, TileBytes>(bytes, rotations, ep,
+                                                                                               execution_policy);
+}
+
+} // namespace rand
+} // namespace arba
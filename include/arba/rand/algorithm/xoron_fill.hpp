@@ -0,0 +1,141 @@
+#pragma once
+
+#include <arba/rand/simd/xoron64_kernels.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Algorithm shared by xoron64_fill and xoron32_fill.
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// Scalar transforms of the expansion steps: alpha is rotl(mask ^ value, rot), beta is ~rotr(mask ^ value, rot).
+template <std::unsigned_integral UintT, bool Beta, UintT XorMask>
+constexpr auto xoron_transform_fn_(int rot, cppx::EndiannessPolicy auto ep)
+{
+    return [=](UintT value) -> UintT
+    {
+        if constexpr (Beta)
+            return core::htow_when(static_cast<UintT>(~std::rotr(UintT(XorMask ^ core::wtoh_when(value, ep)), rot)),
+                                   ep);
+        else
+            return core::htow_when(std::rotl(UintT(XorMask ^ core::wtoh_when(value, ep)), rot), ep);
+    };
+}
+
+// Transform of an expansion step over a range of words, with the SIMD kernel of the active instruction set for the
+// bulk of the range (64-bit words only).
+template <std::unsigned_integral UintT, bool Beta, UintT XorMask>
+void xoron_transform_(std::span<const UintT> input_ints, std::span<UintT> output_ints, int rot,
+                      cppx::EndiannessPolicy auto ep)
+{
+    std::size_t simd_size = 0;
+    if constexpr (std::is_same_v<UintT, uint64_t>)
+        simd_size = xoron64_transform_simd_<Beta>(input_ints, output_ints, XorMask, rot, ep);
+    std::transform(input_ints.begin() + simd_size, input_ints.begin() + output_ints.size(),
+                   output_ints.begin() + simd_size, xoron_transform_fn_<UintT, Beta, XorMask>(rot, ep));
+}
+
+// Expansion step: the input words (at an unaligned byte offset in the generated prefix) are written transformed twice
+// after the prefix, rotated left with the alpha mask, then inverted and rotated right with the beta mask. With tiles,
+// both outputs of an input tile are written one after the other, while the tile is still in cache: the input is read
+// once from memory instead of twice. The tiles are distributed with the execution policy.
+template <std::unsigned_integral UintT, UintT AlphaXorMask, UintT BetaXorMask, std::size_t TileBytes>
+void xoron_expand_(std::span<const UintT> input_ints, std::span<UintT> alpha_ints, std::span<UintT> beta_ints,
+                   int rot, cppx::EndiannessPolicy auto ep, cppx::ExecutionPolicy auto execution_policy)
+{
+    using execution_policy_t = std::remove_cvref_t<decltype(execution_policy)>;
+
+    constexpr std::size_t tile_size = TileBytes / sizeof(UintT);
+    if (tile_size == 0 && !std::is_same_v<execution_policy_t, std::execution::sequenced_policy>)
+    {
+        std::transform(execution_policy, input_ints.begin(), input_ints.begin() + alpha_ints.size(),
+                       alpha_ints.begin(), xoron_transform_fn_<UintT, false, AlphaXorMask>(rot, ep));
+        std::transform(execution_policy, input_ints.begin(), input_ints.begin() + beta_ints.size(), beta_ints.begin(),
+                       xoron_transform_fn_<UintT, true, BetaXorMask>(rot, ep));
+        return;
+    }
+    if (tile_size == 0 || alpha_ints.size() <= tile_size)
+    {
+        xoron_transform_<UintT, false, AlphaXorMask>(input_ints, alpha_ints, rot, ep);
+        xoron_transform_<UintT, true, BetaXorMask>(input_ints, beta_ints, rot, ep);
+        return;
+    }
+
+    std::vector<std::size_t> tile_indexes((alpha_ints.size() + tile_size - 1) / tile_size);
+    std::iota(tile_indexes.begin(), tile_indexes.end(), 0);
+    std::for_each(execution_policy, tile_indexes.cbegin(), tile_indexes.cend(),
+                  [&](std::size_t tile_index)
+                  {
+                      const std::size_t first = tile_index * tile_size;
+                      const std::size_t alpha_last = std::min(first + tile_size, alpha_ints.size());
+                      xoron_transform_<UintT, false, AlphaXorMask>(
+                          input_ints.subspan(first), alpha_ints.subspan(first, alpha_last - first), rot, ep);
+                      const std::size_t beta_last = std::min(first + tile_size, beta_ints.size());
+                      if (first < beta_last)
+                          xoron_transform_<UintT, true, BetaXorMask>(
+                              input_ints.subspan(first), beta_ints.subspan(first, beta_last - first), rot, ep);
+                  });
+}
+
+// Fills the bytes following the InitRangeSize first ones (already generated) by repeated expansion steps, one per
+// rotation, each one appending two transformed copies of the generated prefix read at the next byte offset (offsets
+// multiple of the word size are skipped). The last bytes, not filling a word, are rotated copies of the first ones.
+template <std::unsigned_integral UintT, std::size_t InitRangeSize, UintT AlphaXorMask, UintT BetaXorMask,
+          std::size_t TileBytes, std::size_t NbRotations>
+std::span<std::byte> xoron_fill_(const std::span<std::byte> bytes, const std::array<int, NbRotations>& rotations,
+                                 cppx::EndiannessPolicy auto ep, cppx::ExecutionPolicy auto execution_policy)
+{
+    using integer_type = UintT;
+
+    const std::span<integer_type> ints = core::as_writable_span<integer_type>(bytes);
+    std::size_t current_byte_size = std::min(InitRangeSize / sizeof(integer_type), ints.size()) * sizeof(integer_type);
+    if (current_byte_size < ints.size_bytes())
+    {
+        std::size_t offset = 1;
+        for (auto rotations_iter = rotations.cbegin();
+             current_byte_size < ints.size_bytes() && rotations_iter != rotations.cend(); ++rotations_iter, ++offset)
+        {
+            if (offset % sizeof(integer_type) == 0)
+                ++offset;
+            const std::size_t max_size_to_copy = (current_byte_size - offset) / sizeof(integer_type);
+            const std::span output_ints = ints.subspan(current_byte_size / sizeof(integer_type));
+            const std::size_t alpha_size = std::min(output_ints.size(), max_size_to_copy);
+            const std::size_t beta_size = std::min(output_ints.size() - alpha_size, max_size_to_copy);
+            const std::span input_ints = core::as_writable_span<integer_type>(bytes.subspan(offset)).first(alpha_size);
+            xoron_expand_<integer_type, AlphaXorMask, BetaXorMask, TileBytes>(
+                input_ints, output_ints.first(alpha_size), output_ints.subspan(alpha_size, beta_size), *rotations_iter,
+                ep, execution_policy);
+            current_byte_size += (alpha_size + beta_size) * sizeof(integer_type);
+        }
+    }
+    if (current_byte_size < bytes.size())
+    {
+        const std::span output_bytes = bytes.subspan(current_byte_size);
+        const std::span input_bytes = bytes.first(output_bytes.size());
+        std::ranges::transform(input_bytes, output_bytes.begin(),
+                               [=](std::byte value) { return std::byte{ std::rotr(static_cast<uint8_t>(value), 2) }; });
+    }
+    return bytes;
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Discrete distribution over [0, size()) with probabilities proportional to the weights, sampled in O(1) with the
+// alias method of Walker, built with Vose's algorithm.
+// A sample takes one 64-bit value: the high half of value * size() is the column, the low half is compared with
+// the threshold of the column to choose between the column and its alias.
+class alias_table
+{
+public:
+    using index_type = uint32_t;
+
+    // Column of the table, 8 bytes: the column is kept when the 32 high bits of the low half of the product are below
+    // threshold, its alias is taken otherwise. A column keeping all its draws is its own alias.
+    struct entry
+    {
+        uint32_t threshold;
+        index_type alias;
+    };
+
+    alias_table() = default;
+
+    explicit alias_table(std::span<const double> weights) : alias_table(weights, std::execution::seq) {}
+
+    alias_table(std::initializer_list<double> weights) : alias_table(std::span(weights.begin(), weights.size())) {}
+
+    // The normalization, the classification of the columns and the final encoding run with the execution policy;
+    // the pairing of the columns is linear and sequential.
+    alias_table(std::span<const double> weights, cppx::ExecutionPolicy auto execution_policy);
+
+    [[nodiscard]] inline std::size_t size() const { return entries_.size(); }
+    [[nodiscard]] inline std::span<const entry> entries() const { return entries_; }
+
+    // Probability of the index, as encoded in the table.
+    [[nodiscard]] double probability(index_type index) const;
+
+    [[nodiscard]] inline index_type sample(uint64_t bits) const
+    {
+        const auto [column, fraction] = split_(bits);
+        const entry& column_entry = entries_[column];
+        return fraction < column_entry.threshold ? column : column_entry.alias;
+    }
+
+    template <std::uniform_random_bit_generator UrngT>
+    [[nodiscard]] index_type operator()(UrngT& rng) const
+    {
+        uniform_int_distribution<uint64_t> distribution;
+        return sample(distribution(rng));
+    }
+
+    // Fills indexes with samples. The 64-bit values are generated in bulk by the range engine, then the columns of a
+    // whole chunk are computed before the table is read, the reads being independent and prefetched.
+    template <RandomNumberRangeGenerator RnrgT>
+    std::span<index_type> operator()(std::span<index_type> indexes, RnrgT& rnrg,
+                                     cppx::ExecutionPolicy auto execution_policy) const;
+
+    template <RandomNumberRangeGenerator RnrgT>
+    std::span<index_type> operator()(std::span<index_type> indexes, RnrgT& rnrg) const
+    {
+        return (*this)(indexes, rnrg, std::execution::seq);
+    }
+
+    static constexpr std::size_t chunk_size = 4096;
+    static constexpr std::size_t prefetch_distance = 16;
+
+private:
+    struct split_result_
+    {
+        index_type column;
+        uint32_t fraction;
+    };
+
+    inline split_result_ split_(uint64_t bits) const
+    {
+        if constexpr (requires { typename private_::wide_uint_<uint64_t>::type; })
+        {
+            using wide_t = typename private_::wide_uint_<uint64_t>::type;
+            const wide_t product = wide_t(bits) * entries_.size();
+            return { static_cast<index_type>(product >> 64),
+                     static_cast<uint32_t>(static_cast<uint64_t>(product) >> 32) };
+        }
+        else
+        {
+            const uint64_t column = (bits >> 32) * entries_.size() >> 32;
+            return { static_cast<index_type>(column), static_cast<uint32_t>(bits) };
+        }
+    }
+
+private:
+    std::vector<entry> entries_;
+};
+
+inline alias_table::alias_table(std::span<const double> weights, cppx::ExecutionPolicy auto execution_policy)
+    : entries_(weights.size())
+{
+    assert(!weights.empty() && weights.size() <= std::numeric_limits<index_type>::max());
+    assert(std::ranges::all_of(weights, [](double weight) { return weight >= 0; }));
+    const std::size_t size = weights.size();
+    const double sum = std::reduce(execution_policy, weights.begin(), weights.end(), 0.);
+    assert(sum > 0);
+
+    // Scaled probabilities: the average column holds 1.
+    std::vector<double> probabilities(size);
+    std::transform(execution_policy, weights.begin(), weights.end(), probabilities.begin(),
+                   [factor = size / sum](double weight) { return weight * factor; });
+
+    // Each column starts as its own alias.
+    std::vector<index_type> aliases(size);
+    std::iota(aliases.begin(), aliases.end(), index_type(0));
+    std::vector<index_type> small_columns(size);
+    std::vector<index_type> large_columns(size);
+    small_columns.erase(std::copy_if(execution_policy, aliases.cbegin(), aliases.cend(), small_columns.begin(),
+                                     [&](index_type column) { return probabilities[column] < 1; }),
+                        small_columns.end());
+    large_columns.erase(std::copy_if(execution_policy, aliases.cbegin(), aliases.cend(), large_columns.begin(),
+                                     [&](index_type column) { return probabilities[column] >= 1; }),
+                        large_columns.end());
+
+    // Each small column is completed by a large one, which becomes small when its remaining part falls below 1.
+    while (!small_columns.empty() && !large_columns.empty())
+    {
+        const index_type small_column = small_columns.back();
+        small_columns.pop_back();
+        const index_type large_column = large_columns.back();
+        aliases[small_column] = large_column;
+        probabilities[large_column] = (probabilities[large_column] + probabilities[small_column]) - 1;
+        if (probabilities[large_column] < 1)
+        {
+            large_columns.pop_back();
+            small_columns.push_back(large_column);
+        }
+    }
+    // The leftovers, due to rounding errors, are full: they keep themselves as alias.
+
+    std::transform(execution_policy, probabilities.cbegin(), probabilities.cend(), aliases.cbegin(), entries_.begin(),
+                   [](double probability, index_type alias)
+                   {
+                       const double threshold = probability * 0x1.0p32;
+                       if (threshold >= 0x1.0p32)
+                           return entry{ std::numeric_limits<uint32_t>::max(), alias };
+                       return entry{ static_cast<uint32_t>(threshold), alias };
+                   });
+}
+
+inline double alias_table::probability(index_type index) const
+{
+    double probability = 0;
+    for (std::size_t i = 0; i < entries_.size(); ++i)
+    {
+        const entry& column_entry = entries_[i];
+        const double kept = column_entry.alias == i ? 1. : column_entry.threshold * 0x1.0p-32;
+        if (i == index)
+            probability += kept;
+        if (column_entry.alias == index && column_entry.alias != i)
+            probability += 1 - kept;
+    }
+    return probability / entries_.size();
+}
+
+template <RandomNumberRangeGenerator RnrgT>
+std::span<alias_table::index_type> alias_table::operator()(std::span<index_type> indexes, RnrgT& rnrg,
+                                                           cppx::ExecutionPolicy auto execution_policy) const
+{
+    std::array<uint64_t, chunk_size> words;
+    for (std::size_t offset = 0; offset < indexes.size(); offset += chunk_size)
+    {
+        const std::span chunk_indexes = indexes.subspan(offset, std::min(chunk_size, indexes.size() - offset));
+        const std::span chunk_words = std::span(words).first(chunk_indexes.size());
+        private_::rnrg_fill_(rnrg, std::as_writable_bytes(chunk_words), execution_policy);
+        for (std::size_t i = 0; i < chunk_words.size(); ++i)
+            chunk_indexes[i] = split_(chunk_words[i]).column;
+        for (std::size_t i = 0; i < chunk_words.size(); ++i)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if (i + prefetch_distance < chunk_words.size())
+                __builtin_prefetch(&entries_[chunk_indexes[i + prefetch_distance]]);
+#endif
+            const entry& column_entry = entries_[chunk_indexes[i]];
+            if (split_(chunk_words[i]).fraction >= column_entry.threshold)
+                chunk_indexes[i] = column_entry.alias;
+        }
+    }
+    return indexes;
+}
+
+} // namespace rand
+} // namespace arba
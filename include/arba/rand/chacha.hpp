@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+
+inline namespace arba
+{
+namespace rand
+{
+
+using chacha_key = std::array<uint32_t, 8>;
+using chacha_block = std::array<uint32_t, 16>;
+
+namespace private_
+{
+
+inline constexpr std::array<uint32_t, 4> chacha_constants_ = { 0x61707865u, 0x3320646eu, 0x79622d32u, 0x6b206574u };
+
+constexpr void chacha_quarter_round_(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d)
+{
+    a += b;
+    d = std::rotl(d ^ a, 16);
+    c += d;
+    b = std::rotl(b ^ c, 12);
+    a += b;
+    d = std::rotl(d ^ a, 8);
+    c += d;
+    b = std::rotl(b ^ c, 7);
+}
+
+} // namespace private_
+
+// ChaCha block function (Bernstein) with a 64-bit block counter and a 64-bit nonce (words 12 to 15 of the state, the
+// layout of the original ChaCha; RFC 8439 splits the same words into a 32-bit counter and a 96-bit nonce). The
+// keystream is the little-endian serialization of the words. Rounds is 8, 12 or 20.
+template <unsigned Rounds = 20>
+    requires(Rounds % 2 == 0)
+constexpr chacha_block chacha(const chacha_key& key, uint64_t counter, uint64_t nonce)
+{
+    chacha_block input = {};
+    for (std::size_t i = 0; i < 4; ++i)
+        input[i] = private_::chacha_constants_[i];
+    for (std::size_t i = 0; i < 8; ++i)
+        input[4 + i] = key[i];
+    input[12] = uint32_t(counter);
+    input[13] = uint32_t(counter >> 32);
+    input[14] = uint32_t(nonce);
+    input[15] = uint32_t(nonce >> 32);
+
+    chacha_block x = input;
+    for (unsigned round = 0; round < Rounds; round += 2)
+    {
+        private_::chacha_quarter_round_(x[0], x[4], x[8], x[12]);
+        private_::chacha_quarter_round_(x[1], x[5], x[9], x[13]);
+        private_::chacha_quarter_round_(x[2], x[6], x[10], x[14]);
+        private_::chacha_quarter_round_(x[3], x[7], x[11], x[15]);
+        private_::chacha_quarter_round_(x[0], x[5], x[10], x[15]);
+        private_::chacha_quarter_round_(x[1], x[6], x[11], x[12]);
+        private_::chacha_quarter_round_(x[2], x[7], x[8], x[13]);
+        private_::chacha_quarter_round_(x[3], x[4], x[9], x[14]);
+    }
+    for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] += input[i];
+    return x;
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <arba/rand/ziggurat.hpp>
+
+#include <concepts>
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Replacement of std::exponential_distribution drawing the values with the ziggurat method: one 64-bit value, one
+// table lookup and one comparison for about 99% of the draws.
+template <std::floating_point RealType = double>
+class exponential_distribution
+{
+public:
+    using result_type = RealType;
+
+    constexpr exponential_distribution() : exponential_distribution(1) {}
+
+    constexpr explicit exponential_distribution(result_type lambda) : lambda_(lambda) {}
+
+    constexpr void reset() {}
+
+    [[nodiscard]] constexpr result_type lambda() const { return lambda_; }
+    [[nodiscard]] constexpr result_type min() const { return 0; }
+    [[nodiscard]] constexpr result_type max() const { return std::numeric_limits<result_type>::max(); }
+
+    template <std::uniform_random_bit_generator UrngT>
+    result_type operator()(UrngT& rng) const
+    {
+        const double value = private_::ziggurat_sample_<private_::ziggurat_exponential_>(rng);
+        return static_cast<result_type>(value) / lambda_;
+    }
+
+    friend constexpr bool operator==(const exponential_distribution&, const exponential_distribution&) = default;
+
+private:
+    result_type lambda_;
+};
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <arba/rand/xorshift.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+// Engine behind the rand_int() functions without engine parameter, one per thread, selected at build time:
+//  - default:                             xorshift64, 8 bytes of state per thread,
+//  - ARBA_RAND_GLOBAL_ENGINE_BUFFERED:    blocks of values generated by a xorshift64_range_engine,
+//  - ARBA_RAND_GLOBAL_ENGINE_MT19937_64:  std::mt19937_64 (sequences of the previous versions).
+// The first two are constant-initialized thread-local variables: a call is inlined, without any initialization guard,
+// and the engine is seeded with std::random_device on its first use in the thread.
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// splitmix64 finalizer: close or small seeds give unrelated states, never null.
+constexpr uint64_t mix_seed_(uint64_t value)
+{
+    value += 0x9e3779b97f4a7c15ull;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value != 0 ? value : 0x9e3779b97f4a7c15ull;
+}
+
+uint64_t random_device_seed_();
+
+#if defined(ARBA_RAND_GLOBAL_ENGINE_MT19937_64)
+
+using rand_int_engine_type_ = std::mt19937_64;
+
+inline rand_int_engine_type_& rand_int_engine_()
+{
+    static thread_local rand_int_engine_type_ instance(random_device_seed_());
+    return instance;
+}
+
+#elif defined(ARBA_RAND_GLOBAL_ENGINE_BUFFERED)
+
+inline constexpr std::size_t global_block_size_ = 512;
+
+inline thread_local std::size_t global_block_index_ = global_block_size_;
+alignas(64) inline thread_local uint64_t global_block_[global_block_size_];
+// State of the range engine, null until the first refill of the thread.
+inline thread_local uint64_t global_range_engine_state_ = 0;
+
+// Fills the block with the values of the range engine from state, and returns the next state. The thread-local
+// variables are only accessed by inline code, so that a shared library and its users never see different copies.
+uint64_t fill_global_block_(uint64_t (&block)[global_block_size_], uint64_t state);
+
+inline void refill_global_block_()
+{
+    uint64_t state = global_range_engine_state_;
+    if (state == 0) [[unlikely]]
+        state = mix_seed_(random_device_seed_());
+    global_range_engine_state_ = fill_global_block_(global_block_, state);
+    global_block_index_ = 0;
+}
+
+// Handle on the block of the calling thread: each call is a load and an increment.
+class rand_int_engine_type_
+{
+public:
+    using result_type = uint64_t;
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    inline result_type operator()()
+    {
+        if (global_block_index_ == global_block_size_) [[unlikely]]
+            refill_global_block_();
+        return global_block_[global_block_index_++];
+    }
+
+    inline void seed(result_type value)
+    {
+        global_range_engine_state_ = mix_seed_(value);
+        global_block_index_ = global_block_size_;
+    }
+};
+
+#else
+
+// State of the xorshift64 engine, null until the first call of the thread.
+inline thread_local uint64_t global_xorshift64_state_ = 0;
+
+// Mixed random device seed of a new thread, stored by the inline caller.
+uint64_t seed_global_xorshift64_();
+
+// Handle on the xorshift64 engine of the calling thread.
+class rand_int_engine_type_
+{
+public:
+    using result_type = uint64_t;
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    inline result_type operator()()
+    {
+        uint64_t state = global_xorshift64_state_;
+        if (state == 0) [[unlikely]]
+            state = seed_global_xorshift64_();
+        return (global_xorshift64_state_ = xorshift64(state));
+    }
+
+    inline void seed(result_type value) { global_xorshift64_state_ = mix_seed_(value); }
+};
+
+#endif
+
+#if !defined(ARBA_RAND_GLOBAL_ENGINE_MT19937_64)
+
+inline rand_int_engine_type_& rand_int_engine_()
+{
+    static constinit rand_int_engine_type_ instance;
+    return instance;
+}
+
+#endif
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
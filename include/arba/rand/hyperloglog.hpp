@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// HyperLogLog sketch (Flajolet, Fusy, Gandouet, Meunier): estimates the number of distinct 64-bit hashes inserted,
+// in 2^Precision bytes, with a relative standard error of 1.04 / sqrt(2^Precision) (0.4% for the default precision).
+// The hashes must be uniformly distributed. Sketches of different parts of a sequence merge into the sketch of the
+// whole sequence.
+template <unsigned Precision = 16>
+    requires(Precision >= 4 && Precision <= 20)
+class hyperloglog
+{
+public:
+    static constexpr unsigned precision = Precision;
+    static constexpr std::size_t nb_registers = std::size_t(1) << Precision;
+
+    hyperloglog() : registers_(nb_registers, 0) {}
+
+    // The high bits of the hash select the register, which keeps the highest rank of the first set bit of the others.
+    inline void insert(uint64_t hash)
+    {
+        const std::size_t index = hash >> (64 - Precision);
+        const uint8_t rank = uint8_t(std::countl_zero((hash << Precision) | (uint64_t(1) << (Precision - 1))) + 1);
+        registers_[index] = std::max(registers_[index], rank);
+    }
+
+    void merge(const hyperloglog& other)
+    {
+        std::ranges::transform(registers_, other.registers_, registers_.begin(),
+                               [](uint8_t rank, uint8_t other_rank) { return std::max(rank, other_rank); });
+    }
+
+    // Harmonic mean of the registers, or linear counting of the empty registers for small cardinalities.
+    [[nodiscard]] double estimate() const
+    {
+        constexpr double nb_registers_f = double(nb_registers);
+        constexpr double alpha = 0.7213 / (1. + 1.079 / nb_registers_f);
+        double sum = 0.;
+        std::size_t nb_empty_registers = 0;
+        for (const uint8_t rank : registers_)
+        {
+            sum += std::ldexp(1., -int(rank));
+            nb_empty_registers += rank == 0;
+        }
+        const double raw_estimate = alpha * nb_registers_f * nb_registers_f / sum;
+        if (raw_estimate <= 2.5 * nb_registers_f && nb_empty_registers > 0)
+            return nb_registers_f * std::log(nb_registers_f / double(nb_empty_registers));
+        return raw_estimate;
+    }
+
+    void clear() { std::ranges::fill(registers_, 0); }
+
+private:
+    std::vector<uint8_t> registers_;
+};
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <arba/rand/ziggurat.hpp>
+
+#include <concepts>
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Replacement of std::normal_distribution drawing the values with the ziggurat method: one 64-bit value, one table
+// lookup and one comparison for about 99% of the draws.
+template <std::floating_point RealType = double>
+class normal_distribution
+{
+public:
+    using result_type = RealType;
+
+    constexpr normal_distribution() : normal_distribution(0) {}
+
+    constexpr explicit normal_distribution(result_type mean, result_type stddev = 1) : mean_(mean), stddev_(stddev) {}
+
+    constexpr void reset() {}
+
+    [[nodiscard]] constexpr result_type mean() const { return mean_; }
+    [[nodiscard]] constexpr result_type stddev() const { return stddev_; }
+    [[nodiscard]] constexpr result_type min() const { return std::numeric_limits<result_type>::lowest(); }
+    [[nodiscard]] constexpr result_type max() const { return std::numeric_limits<result_type>::max(); }
+
+    template <std::uniform_random_bit_generator UrngT>
+    result_type operator()(UrngT& rng) const
+    {
+        const double value = private_::ziggurat_sample_<private_::ziggurat_normal_>(rng);
+        return mean_ + stddev_ * static_cast<result_type>(value);
+    }
+
+    friend constexpr bool operator==(const normal_distribution&, const normal_distribution&) = default;
+
+private:
+    result_type mean_;
+    result_type stddev_;
+};
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+
+inline namespace arba
+{
+namespace rand
+{
+
+using philox4x32_counter = std::array<uint32_t, 4>;
+using philox4x32_key = std::array<uint32_t, 2>;
+
+// Philox4x32 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"): a keyed bijection of 128-bit counters,
+// whose output is random for any counter. Rounds multiply two words of the counter, xoring the high halves of the
+// products with the other words and the round key.
+template <unsigned Rounds = 10>
+constexpr philox4x32_counter philox4x32(philox4x32_counter counter, philox4x32_key key)
+{
+    for (unsigned round = 0; round < Rounds; ++round)
+    {
+        if (round > 0)
+        {
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+        const uint64_t product_0 = uint64_t(0xD2511F53u) * counter[0];
+        const uint64_t product_1 = uint64_t(0xCD9E8D57u) * counter[2];
+        counter = { uint32_t(product_1 >> 32) ^ counter[1] ^ key[0], uint32_t(product_1),
+                    uint32_t(product_0 >> 32) ^ counter[3] ^ key[1], uint32_t(product_0) };
+    }
+    return counter;
+}
+
+} // namespace rand
+} // namespace arba
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <arba/rand/global_engine.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
 #include <random>
 
 inline namespace arba
@@ -16,26 +19,17 @@ template <std::integral IntType, std::uniform_random_bit_generator UrngT>
     }
     else
     {
-        return std::uniform_int_distribution<IntType>(std::numeric_limits<IntType>::min(),
-                                                      std::numeric_limits<IntType>::max())(rng);
+        return uniform_int_distribution<IntType>(std::numeric_limits<IntType>::min(),
+                                                 std::numeric_limits<IntType>::max())(rng);
     }
 }
 
 template <std::integral IntType, std::uniform_random_bit_generator UrngT>
 [[nodiscard]] inline IntType rand_int(UrngT& rng, IntType min, IntType max)
 {
-    return std::uniform_int_distribution<IntType>(min, max)(rng);
+    return uniform_int_distribution<IntType>(min, max)(rng);
 }
 
-namespace private_
-{
-
-using rand_int_engine_type_ = std::mt19937_64;
-
-rand_int_engine_type_& rand_int_engine_();
-
-} // namespace private_
-
 template <std::integral IntType>
 [[nodiscard]] inline IntType rand_int()
 {
@@ -45,20 +39,20 @@ template <std::integral IntType>
     }
     else
     {
-        return std::uniform_int_distribution<IntType>(
-            std::numeric_limits<IntType>::min(), std::numeric_limits<IntType>::max())(private_::rand_int_engine_());
+        return uniform_int_distribution<IntType>(std::numeric_limits<IntType>::min(),
+                                                 std::numeric_limits<IntType>::max())(private_::rand_int_engine_());
     }
 }
 
 template <std::integral IntType>
 [[nodiscard]] inline IntType rand_int(IntType min, IntType max)
 {
-    return std::uniform_int_distribution<IntType>(min, max)(private_::rand_int_engine_());
+    return uniform_int_distribution<IntType>(min, max)(private_::rand_int_engine_());
 }
 
 inline void reseed()
 {
-    private_::rand_int_engine_().seed(std::random_device{}());
+    private_::rand_int_engine_().seed(private_::random_device_seed_());
 }
 
 inline void reseed(private_::rand_int_engine_type_::result_type value)
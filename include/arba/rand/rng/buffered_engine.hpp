@@ -0,0 +1,114 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <random>
+#include <span>
+#include <utility>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Uniform random bit generator serving the values of a block generated at once by a range engine: a call is a load
+// and an increment, the refill of the block running at the throughput of the range engine (with the execution
+// policy, useful for huge blocks). The block is allocated on the heap, aligned on a cache line.
+template <RandomNumberRangeGenerator RangeEngineT, std::size_t BlockBytes = 16 * 1024,
+          cppx::ExecutionPolicy ExecutionPolicyT = std::execution::sequenced_policy>
+    requires(BlockBytes > 0 && BlockBytes % sizeof(typename RangeEngineT::integer_type) == 0)
+class buffered_engine
+{
+public:
+    using range_engine_type = RangeEngineT;
+    using result_type = typename range_engine_type::integer_type;
+    using execution_policy_type = ExecutionPolicyT;
+
+    static constexpr std::size_t block_bytes = BlockBytes;
+    static constexpr std::size_t block_size = BlockBytes / sizeof(result_type);
+
+    inline explicit buffered_engine(result_type seed) : range_engine_(seed), block_(new block_type_) {}
+
+    buffered_engine() : block_(new block_type_) {}
+
+    inline explicit buffered_engine(range_engine_type range_engine)
+        : range_engine_(std::move(range_engine)), block_(new block_type_)
+    {
+    }
+
+    buffered_engine(const buffered_engine& other)
+        : range_engine_(other.range_engine_), block_(new block_type_(*other.block_)), index_(other.index_)
+    {
+    }
+
+    buffered_engine(buffered_engine&&) noexcept = default;
+
+    buffered_engine& operator=(const buffered_engine& other)
+    {
+        if (this != &other)
+            *this = buffered_engine(other);
+        return *this;
+    }
+
+    buffered_engine& operator=(buffered_engine&&) noexcept = default;
+
+    inline result_type operator()()
+    {
+        if (index_ == block_size) [[unlikely]]
+            refill_();
+        return block_->values[index_++];
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Seeds the range engine and drops the remaining values of the block.
+    inline void seed(result_type value)
+    {
+        range_engine_.seed(value);
+        index_ = block_size;
+    }
+
+    // Skips values: the blocks on the way are generated, as range engines cannot jump by a number of values.
+    void discard(unsigned long long times)
+    {
+        while (times > block_size - index_)
+        {
+            times -= block_size - index_;
+            refill_();
+        }
+        index_ += times;
+    }
+
+    [[nodiscard]] inline const range_engine_type& range_engine() const { return range_engine_; }
+
+    // Number of values left in the block.
+    [[nodiscard]] inline std::size_t available() const { return block_size - index_; }
+
+private:
+    struct alignas(64) block_type_
+    {
+        std::array<result_type, block_size> values;
+    };
+
+    [[gnu::noinline]] void refill_()
+    {
+        private_::rnrg_fill_(range_engine_, std::as_writable_bytes(std::span(block_->values)), execution_policy_type{});
+        index_ = 0;
+    }
+
+private:
+    range_engine_type range_engine_;
+    std::unique_ptr<block_type_> block_;
+    std::size_t index_ = block_size;
+};
+
+} // namespace rand
+} // namespace arba
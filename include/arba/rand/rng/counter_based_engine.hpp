@@ -0,0 +1,86 @@
+#pragma once
+
+#include <arba/rand/algorithm/counter_based_fill.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// Engine over a counter-based generator: the key replaces the state, and the value at an index is computed without
+// the previous ones, so that discard, set_position and value_at run in constant time. The block of the last value is
+// cached.
+template <class GeneratorT>
+class counter_based_engine_
+{
+public:
+    using result_type = typename GeneratorT::word_type;
+    using key_type = typename GeneratorT::key_type;
+    static constexpr std::size_t block_size = GeneratorT::block_size;
+
+    inline explicit counter_based_engine_(uint64_t seed) : counter_based_engine_(GeneratorT::key_from_seed(seed)) {}
+
+    inline explicit counter_based_engine_(const key_type& key) : key_(key) {}
+
+    counter_based_engine_() : counter_based_engine_(uint64_t(std::random_device{}())) {}
+
+    inline result_type operator()()
+    {
+        if (const uint64_t block_index = position_ / block_size; block_index != block_index_)
+        {
+            block_ = GeneratorT::block(block_index, key_);
+            block_index_ = block_index;
+        }
+        return block_[position_++ % block_size];
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Sets the key derived from the seed and restarts at index 0.
+    inline void seed(uint64_t value) { *this = counter_based_engine_(value); }
+
+    [[nodiscard]] inline const key_type& key() const { return key_; }
+
+    // Index of the next value.
+    [[nodiscard]] inline uint64_t position() const { return position_; }
+
+    inline void set_position(uint64_t index) { position_ = index; }
+
+    inline void discard(unsigned long long times) { position_ += times; }
+
+    // Value at the index, whatever the position.
+    [[nodiscard]] inline result_type value_at(uint64_t index) const
+    {
+        return GeneratorT::block(index / block_size, key_)[index % block_size];
+    }
+
+private:
+    key_type key_;
+    uint64_t position_ = 0;
+    // No block index reaches the maximum: block_size > 1.
+    uint64_t block_index_ = std::numeric_limits<uint64_t>::max();
+    typename GeneratorT::block_type block_{};
+};
+
+} // namespace private_
+
+// Philox4x32 engine: value i is the word i % 4 of philox4x32<Rounds>({ i / 4 }, key), the key being the low and high
+// halves of the seed.
+template <unsigned Rounds = 10>
+using philox4x32_engine = private_::counter_based_engine_<private_::philox4x32_generator_<Rounds>>;
+
+// Threefry2x64 engine: value i is the word i % 2 of threefry2x64<Rounds>({ i / 2, 0 }, key), the key being
+// { seed, 0 }.
+template <unsigned Rounds = 20>
+using threefry2x64_engine = private_::counter_based_engine_<private_::threefry2x64_generator_<Rounds>>;
+
+} // namespace rand
+} // namespace arba
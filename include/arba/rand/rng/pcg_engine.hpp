@@ -0,0 +1,184 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// State of a linear congruential generator delta steps ahead, in O(log(delta)) steps (Brown, "Random Number
+// Generation with Arbitrary Strides"): the multiplier and the increment of the jump are built by squaring.
+template <class StateT>
+constexpr StateT lcg_advance_(StateT state, StateT delta, StateT multiplier, StateT increment)
+{
+    StateT jump_multiplier = 1;
+    StateT jump_increment = 0;
+    for (; delta > 0; delta >>= 1)
+    {
+        if (delta & 1)
+        {
+            jump_multiplier *= multiplier;
+            jump_increment = jump_increment * multiplier + increment;
+        }
+        increment = (multiplier + 1) * increment;
+        multiplier *= multiplier;
+    }
+    return jump_multiplier * state + jump_increment;
+}
+
+// Permutations of the PCG engines (O'Neill, pcg-random.org), applied to the state before (output_previous) or after
+// the step, as in the reference implementation.
+
+struct pcg32_xsh_rr_
+{
+    using state_type = uint64_t;
+    using result_type = uint32_t;
+
+    static constexpr state_type multiplier = 6364136223846793005ull;
+    static constexpr state_type default_increment = 1442695040888963407ull;
+    static constexpr bool output_previous = true;
+
+    static constexpr result_type output(state_type state)
+    {
+        return std::rotr(static_cast<result_type>(((state >> 18) ^ state) >> 27), static_cast<int>(state >> 59));
+    }
+};
+
+#ifdef __SIZEOF_INT128__
+
+// 128-bit integers are a GCC and Clang extension, which __extension__ keeps quiet under -Wpedantic. Without them
+// (MSVC), the 128-bit engines are not defined.
+__extension__ typedef unsigned __int128 uint128_t_;
+
+inline constexpr uint128_t_ make_uint128_(uint64_t high, uint64_t low)
+{
+    return (static_cast<uint128_t_>(high) << 64) | low;
+}
+
+struct pcg64_xsl_rr_
+{
+    using state_type = uint128_t_;
+    using result_type = uint64_t;
+
+    static constexpr state_type multiplier = make_uint128_(2549297995355413924ull, 4865540595714422341ull);
+    static constexpr state_type default_increment = make_uint128_(6364136223846793005ull, 1442695040888963407ull);
+    static constexpr bool output_previous = false;
+
+    static constexpr result_type output(state_type state)
+    {
+        return std::rotr(static_cast<result_type>(state >> 64) ^ static_cast<result_type>(state),
+                         static_cast<int>(state >> 122));
+    }
+};
+
+// "Double xorshift multiply" permutation with the 64-bit cheap multiplier, also used for the step: stronger than
+// XSL-RR for the same speed.
+struct pcg64_dxsm_
+{
+    using state_type = uint128_t_;
+    using result_type = uint64_t;
+
+    static constexpr uint64_t cheap_multiplier = 0xda942042e4dd58b5ull;
+    static constexpr state_type multiplier = cheap_multiplier;
+    static constexpr state_type default_increment = make_uint128_(6364136223846793005ull, 1442695040888963407ull);
+    static constexpr bool output_previous = true;
+
+    static constexpr result_type output(state_type state)
+    {
+        result_type high = static_cast<result_type>(state >> 64);
+        const result_type low = static_cast<result_type>(state) | 1;
+        high ^= high >> 32;
+        high *= cheap_multiplier;
+        high ^= high >> 48;
+        return high * low;
+    }
+};
+
+#endif
+
+// PCG engine: a linear congruential generator whose state goes through a permutation. The increment selects one of
+// 2^(state bits - 1) streams, so that engines with the same seed and different stream ids are independent, and
+// advance() jumps in O(log(delta)).
+template <class PermutationT>
+class pcg_engine_
+{
+public:
+    using result_type = typename PermutationT::result_type;
+    using state_type = typename PermutationT::state_type;
+
+    // Engine on the default stream.
+    inline explicit pcg_engine_(uint64_t seed) : increment_(PermutationT::default_increment) { init_(seed); }
+
+    // Engine on the stream stream_id, whose highest bit is ignored.
+    inline pcg_engine_(uint64_t seed, state_type stream_id) : increment_((stream_id << 1) | 1)
+    {
+        init_(seed);
+    }
+
+    pcg_engine_() : pcg_engine_((uint64_t(std::random_device{}()) << 32) | std::random_device{}()) {}
+
+    inline result_type operator()()
+    {
+        const state_type old_state = state_;
+        state_ = state_ * PermutationT::multiplier + increment_;
+        return PermutationT::output(PermutationT::output_previous ? old_state : state_);
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Last seed value, the state not being a seed.
+    [[nodiscard]] inline uint64_t seed() const { return seed_; }
+
+    // Restarts the stream of the engine.
+    inline void seed(uint64_t value) { init_(value); }
+
+    [[nodiscard]] inline state_type state() const { return state_; }
+
+    [[nodiscard]] inline state_type stream() const { return increment_ >> 1; }
+
+    inline void discard(unsigned long long times) { advance(times); }
+
+    // Skips delta values (the state moves back when delta is a negative number cast to state_type).
+    inline void advance(state_type delta)
+    {
+        state_ = lcg_advance_<state_type>(state_, delta, PermutationT::multiplier, increment_);
+    }
+
+private:
+    // Same initialization as the reference implementation: the seed is added to the state after the first step.
+    inline void init_(uint64_t seed)
+    {
+        seed_ = seed;
+        state_ = (increment_ + seed) * PermutationT::multiplier + increment_;
+    }
+
+private:
+    state_type state_;
+    state_type increment_;
+    uint64_t seed_;
+};
+
+} // namespace private_
+
+// pcg32 (XSH RR 64/32): 64 bits of state, 32-bit values.
+using pcg32_engine = private_::pcg_engine_<private_::pcg32_xsh_rr_>;
+
+#ifdef __SIZEOF_INT128__
+// pcg64 (XSL RR 128/64): 128 bits of state, 64-bit values.
+using pcg64_engine = private_::pcg_engine_<private_::pcg64_xsl_rr_>;
+
+// pcg64 DXSM (128/64): the stronger 64-bit variant, default generator of NumPy.
+using pcg64_dxsm_engine = private_::pcg_engine_<private_::pcg64_dxsm_>;
+#endif
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <arba/rand/xoshiro.hpp>
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// RomuTrio (Overton): three words of state, one multiplication and two rotations per value, the result being computed
+// in parallel with the next state. Non-linear, without guaranteed period: its authors estimate its capacity to 2^75
+// bytes. The state is expanded from the seed with splitmix64.
+class romu_trio_engine
+{
+public:
+    using result_type = uint64_t;
+    using state_type = std::array<uint64_t, 3>;
+
+    inline explicit romu_trio_engine(result_type seed)
+        : seed_(seed),
+          state_{ private_::splitmix64_next_(seed), private_::splitmix64_next_(seed), private_::splitmix64_next_(seed) }
+    {
+    }
+
+    romu_trio_engine() : romu_trio_engine(std::random_device{}()) {}
+
+    inline result_type operator()()
+    {
+        auto& [x, y, z] = state_;
+        const uint64_t previous_x = x, previous_y = y, previous_z = z;
+        x = 15241094284759029579ull * previous_z;
+        y = std::rotl(previous_y - previous_x, 12);
+        z = std::rotl(previous_z - previous_y, 44);
+        return previous_x;
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Last seed value, the state not fitting in a result_type.
+    [[nodiscard]] inline result_type seed() const { return seed_; }
+
+    inline void seed(result_type value) { *this = romu_trio_engine(value); }
+
+    [[nodiscard]] inline const state_type& state() const { return state_; }
+
+    inline void discard(unsigned long long times)
+    {
+        for (; times > 0; --times)
+            (*this)();
+    }
+
+private:
+    result_type seed_;
+    state_type state_;
+};
+
+// RomuDuoJr (Overton): two words of state, the fastest of the family, with an estimated capacity of 2^51 bytes only:
+// prefer romu_trio_engine for long sequences.
+class romu_duo_jr_engine
+{
+public:
+    using result_type = uint64_t;
+    using state_type = std::array<uint64_t, 2>;
+
+    inline explicit romu_duo_jr_engine(result_type seed)
+        : seed_(seed), state_{ private_::splitmix64_next_(seed), private_::splitmix64_next_(seed) }
+    {
+    }
+
+    romu_duo_jr_engine() : romu_duo_jr_engine(std::random_device{}()) {}
+
+    inline result_type operator()()
+    {
+        auto& [x, y] = state_;
+        const uint64_t previous_x = x;
+        x = 15241094284759029579ull * y;
+        y = std::rotl(y - previous_x, 27);
+        return previous_x;
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Last seed value, the state not fitting in a result_type.
+    [[nodiscard]] inline result_type seed() const { return seed_; }
+
+    inline void seed(result_type value) { *this = romu_duo_jr_engine(value); }
+
+    [[nodiscard]] inline const state_type& state() const { return state_; }
+
+    inline void discard(unsigned long long times)
+    {
+        for (; times > 0; --times)
+            (*this)();
+    }
+
+private:
+    result_type seed_;
+    state_type state_;
+};
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// SFC64 (Doty-Humphrey): a chaotic state of three words plus a counter, which guarantees a period of at least 2^64.
+// No multiplication. The state is seeded as in PractRand: the seed in the three words, 12 values discarded.
+class sfc64_engine
+{
+public:
+    using result_type = uint64_t;
+    using state_type = std::array<uint64_t, 4>;
+
+    inline explicit sfc64_engine(result_type seed) : seed_(seed), state_{ seed, seed, seed, 1 } { discard(12); }
+
+    sfc64_engine() : sfc64_engine(std::random_device{}()) {}
+
+    inline result_type operator()()
+    {
+        auto& [a, b, c, counter] = state_;
+        const uint64_t value = a + b + counter++;
+        a = b ^ (b >> 11);
+        b = c + (c << 3);
+        c = std::rotl(c, 24) + value;
+        return value;
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Last seed value, the state not fitting in a result_type.
+    [[nodiscard]] inline result_type seed() const { return seed_; }
+
+    inline void seed(result_type value) { *this = sfc64_engine(value); }
+
+    [[nodiscard]] inline const state_type& state() const { return state_; }
+
+    inline void discard(unsigned long long times)
+    {
+        for (; times > 0; --times)
+            (*this)();
+    }
+
+private:
+    result_type seed_;
+    state_type state_;
+};
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <arba/rand/xoshiro.hpp>
+
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// splitmix64 (Steele, Lea, Flood): 64 bits of state incremented by a Weyl constant, then mixed. Period 2^64, every
+// value once. Seeds the state of the other engines; discard is constant time.
+class splitmix64_engine
+{
+public:
+    using result_type = uint64_t;
+
+    inline explicit splitmix64_engine(result_type seed) : state_(seed) {}
+
+    splitmix64_engine() : splitmix64_engine(std::random_device{}()) {}
+
+    inline result_type operator()() { return private_::splitmix64_next_(state_); }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    [[nodiscard]] inline result_type seed() const { return state_; }
+
+    inline void seed(result_type value) { state_ = value; }
+
+    inline void discard(unsigned long long times) { state_ += times * 0x9e3779b97f4a7c15ull; }
+
+private:
+    result_type state_;
+};
+
+} // namespace rand
+} // namespace arba
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <arba/rand/rng/wyrand_engine.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
 #include <random>
 
 inline namespace arba
@@ -39,7 +42,7 @@ class uniform_engine_impl_<RNG, IntType, MinValue, MaxValue> : public RNG
 public:
     using integer_type = integer_type_t_<IntType>;
     using result_type = IntType;
-    using distribution_type = std::uniform_int_distribution<integer_type>;
+    using distribution_type = uniform_int_distribution<integer_type>;
 
     explicit uniform_engine_impl_(typename RNG::result_type seed) : RNG(seed) {}
 
@@ -65,8 +68,8 @@ public:
 
     static constexpr distribution_type distribution()
     {
-        return std::uniform_int_distribution<integer_type>(static_cast<integer_type>(min()),
-                                                           static_cast<integer_type>(max()));
+        return uniform_int_distribution<integer_type>(static_cast<integer_type>(min()),
+                                                      static_cast<integer_type>(max()));
     }
 };
 
@@ -76,7 +79,7 @@ class uniform_engine_impl_<RNG, IntType> : public RNG
 public:
     using integer_type = integer_type_t_<IntType>;
     using result_type = IntType;
-    using distribution_type = std::uniform_int_distribution<integer_type>;
+    using distribution_type = uniform_int_distribution<integer_type>;
 
     explicit uniform_engine_impl_(typename RNG::result_type seed, distribution_type dist = distribution_type())
         : RNG(seed), dist_(std::move(dist))
@@ -148,5 +151,34 @@ using urng_i64 = uniform_engine<std::mt19937_64, std::int_fast64_t, IntParams...
 template <std::byte... IntParams>
 using urng_byte = uniform_engine<std::mt19937, std::byte, IntParams...>;
 
+// Same aliases with wyrand_engine: 8 bytes of state instead of the 2.5 KB of the Mersenne Twister, and faster calls.
+// Their sequences differ from the ones of urng_*.
+template <std::uint_fast8_t... IntParams>
+using fast_urng_u8 = uniform_engine<wyrand_engine, std::uint_fast8_t, IntParams...>;
+
+template <std::int_fast8_t... IntParams>
+using fast_urng_i8 = uniform_engine<wyrand_engine, std::int_fast8_t, IntParams...>;
+
+template <std::uint_fast16_t... IntParams>
+using fast_urng_u16 = uniform_engine<wyrand_engine, std::uint_fast16_t, IntParams...>;
+
+template <std::int_fast16_t... IntParams>
+using fast_urng_i16 = uniform_engine<wyrand_engine, std::int_fast16_t, IntParams...>;
+
+template <std::uint_fast32_t... IntParams>
+using fast_urng_u32 = uniform_engine<wyrand_engine, std::uint_fast32_t, IntParams...>;
+
+template <std::int_fast32_t... IntParams>
+using fast_urng_i32 = uniform_engine<wyrand_engine, std::int_fast32_t, IntParams...>;
+
+template <std::uint_fast64_t... IntParams>
+using fast_urng_u64 = uniform_engine<wyrand_engine, std::uint_fast64_t, IntParams...>;
+
+template <std::int_fast64_t... IntParams>
+using fast_urng_i64 = uniform_engine<wyrand_engine, std::int_fast64_t, IntParams...>;
+
+template <std::byte... IntParams>
+using fast_urng_byte = uniform_engine<wyrand_engine, std::byte, IntParams...>;
+
 } // namespace rand
 } // namespace arba
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// High and low halves of the 128-bit product, xored.
+inline constexpr uint64_t wymix_(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    // GCC and Clang extension, which __extension__ keeps quiet under -Wpedantic.
+    __extension__ typedef unsigned __int128 uint128_t;
+    const uint128_t product = static_cast<uint128_t>(a) * b;
+    return uint64_t(product) ^ uint64_t(product >> 64);
+#else
+#if defined(_MSC_VER) && defined(_M_X64)
+    if (!std::is_constant_evaluated())
+    {
+        unsigned __int64 high;
+        const unsigned __int64 low = _umul128(a, b, &high);
+        return low ^ high;
+    }
+#endif
+    const uint64_t a_high = a >> 32, a_low = uint32_t(a), b_high = b >> 32, b_low = uint32_t(b);
+    const uint64_t high_high = a_high * b_high, high_low = a_high * b_low, low_high = a_low * b_high;
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t middle = high_low + low_high;
+    const uint64_t low = low_low + (middle << 32);
+    const uint64_t high = high_high + (middle >> 32) + (uint64_t(middle < high_low) << 32) + uint64_t(low < low_low);
+    return low ^ high;
+#endif
+}
+
+} // namespace private_
+
+// wyrand (Wang Yi): 64 bits of state incremented by a constant, mixed by a 64x64 -> 128 bits multiplication. Period
+// 2^64, one multiplication per value; discard is constant time.
+class wyrand_engine
+{
+public:
+    using result_type = uint64_t;
+
+    inline explicit wyrand_engine(result_type seed) : state_(seed) {}
+
+    wyrand_engine() : wyrand_engine(std::random_device{}()) {}
+
+    inline result_type operator()()
+    {
+        state_ += increment_;
+        return private_::wymix_(state_, state_ ^ 0xe7037ed1a0b428dbull);
+    }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    [[nodiscard]] inline result_type seed() const { return state_; }
+
+    inline void seed(result_type value) { state_ = value; }
+
+    inline void discard(unsigned long long times) { state_ += times * increment_; }
+
+private:
+    static constexpr uint64_t increment_ = 0xa0761d6478bd642full;
+
+    result_type state_;
+};
+
+} // namespace rand
+} // namespace arba
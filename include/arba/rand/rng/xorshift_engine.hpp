@@ -1,6 +1,7 @@
 #pragma once
 
 #include <arba/rand/xorshift.hpp>
+#include <arba/rand/xorshift_jump.hpp>
 
 #include <random>
 
@@ -32,11 +33,7 @@ public:
 
     inline void seed(result_type value) { state_ = xorshift32_engine(value).seed(); }
 
-    inline void discard(unsigned long long times)
-    {
-        for (; times > 0; --times)
-            state_ = xorshift32(state_);
-    }
+    inline void discard(unsigned long long times) { state_ = xorshift32_jump(state_, times); }
 
 private:
     result_type state_;
@@ -65,11 +62,7 @@ public:
 
     inline void seed(result_type value) { state_ = xorshift64_engine(value).seed(); }
 
-    inline void discard(unsigned long long times)
-    {
-        for (; times > 0; --times)
-            state_ = xorshift64(state_);
-    }
+    inline void discard(unsigned long long times) { state_ = xorshift64_jump(state_, times); }
 
 private:
     result_type state_;
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <arba/rand/xoshiro.hpp>
+#include <arba/rand/xoshiro_jump.hpp>
+
+#include <limits>
+#include <random>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// xoshiro256** (Blackman, Vigna): 256 bits of state, period 2^256 - 1, passes the linear complexity tests failed by
+// xorshift. The state is expanded from the seed with splitmix64.
+class xoshiro256ss_engine
+{
+public:
+    using result_type = uint64_t;
+    using state_type = xoshiro256_state;
+
+    inline explicit xoshiro256ss_engine(result_type seed) : seed_(seed), state_(xoshiro256_seed_state(seed)) {}
+
+    xoshiro256ss_engine() : xoshiro256ss_engine(std::random_device{}()) {}
+
+    inline result_type operator()() { return xoshiro256ss(state_); }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Last seed value, the state not fitting in a result_type.
+    [[nodiscard]] inline result_type seed() const { return seed_; }
+
+    inline void seed(result_type value) { *this = xoshiro256ss_engine(value); }
+
+    [[nodiscard]] inline const state_type& state() const { return state_; }
+
+    inline void discard(unsigned long long times) { state_ = xoshiro256_jump(state_, times); }
+
+    // Skips 2^128 values: 2^128 non-overlapping sequences, one per thread, start at the jumps of an engine.
+    inline void jump() { state_ = xoshiro256_jump(state_); }
+
+    // Skips 2^192 values: 2^64 starting points, each one followed by 2^64 jumps.
+    inline void long_jump() { state_ = xoshiro256_long_jump(state_); }
+
+private:
+    result_type seed_;
+    state_type state_;
+};
+
+// xoroshiro128+ (Blackman, Vigna): 128 bits of state, period 2^128 - 1, the fastest of the family. Its lowest bits
+// have a low linear complexity: prefer xoshiro256ss_engine when they are used alone.
+class xoroshiro128plus_engine
+{
+public:
+    using result_type = uint64_t;
+    using state_type = xoroshiro128_state;
+
+    inline explicit xoroshiro128plus_engine(result_type seed) : seed_(seed), state_(xoroshiro128_seed_state(seed)) {}
+
+    xoroshiro128plus_engine() : xoroshiro128plus_engine(std::random_device{}()) {}
+
+    inline result_type operator()() { return xoroshiro128plus(state_); }
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Last seed value, the state not fitting in a result_type.
+    [[nodiscard]] inline result_type seed() const { return seed_; }
+
+    inline void seed(result_type value) { *this = xoroshiro128plus_engine(value); }
+
+    [[nodiscard]] inline const state_type& state() const { return state_; }
+
+    inline void discard(unsigned long long times) { state_ = xoroshiro128_jump(state_, times); }
+
+    // Skips 2^64 values: 2^64 non-overlapping sequences, one per thread, start at the jumps of an engine.
+    inline void jump() { state_ = xoroshiro128_jump(state_); }
+
+    // Skips 2^96 values: 2^32 starting points, each one followed by 2^32 jumps.
+    inline void long_jump() { state_ = xoroshiro128_long_jump(state_); }
+
+private:
+    result_type seed_;
+    state_type state_;
+};
+
+} // namespace rand
+} // namespace arba
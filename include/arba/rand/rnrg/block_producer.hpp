@@ -0,0 +1,334 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+
+#include <arba/cppx/policy/endianness_policy.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// Bounded lock-free multi-producer multi-consumer queue of block indexes (Vyukov): each cell holds a sequence number
+// telling whether it is ready to be written or read at a given position.
+class block_index_ring_
+{
+public:
+    explicit block_index_ring_(std::size_t capacity) : cells_(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+    {
+        for (std::size_t i = 0; i < cells_.size(); ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    bool try_push(uint32_t index)
+    {
+        std::size_t position = push_position_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell_& cell = cells_[position & (cells_.size() - 1)];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position);
+            if (difference == 0)
+            {
+                if (push_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    cell.index = index;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+                return false;
+            else
+                position = push_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::optional<uint32_t> try_pop()
+    {
+        std::size_t position = pop_position_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell_& cell = cells_[position & (cells_.size() - 1)];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position + 1);
+            if (difference == 0)
+            {
+                if (pop_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    const uint32_t index = cell.index;
+                    cell.sequence.store(position + cells_.size(), std::memory_order_release);
+                    return index;
+                }
+            }
+            else if (difference < 0)
+                return std::nullopt;
+            else
+                position = pop_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct cell_
+    {
+        std::atomic<std::size_t> sequence;
+        uint32_t index;
+    };
+
+    std::vector<cell_> cells_;
+    alignas(64) std::atomic<std::size_t> push_position_ = 0;
+    alignas(64) std::atomic<std::size_t> pop_position_ = 0;
+};
+
+} // namespace private_
+
+// Counters of a block_producer, to size its ring: a consumer stalls when no block is ready.
+struct block_producer_metrics
+{
+    uint64_t nb_produced_blocks = 0;
+    uint64_t nb_acquired_blocks = 0;
+    uint64_t nb_stalls = 0;
+    std::chrono::nanoseconds total_stall_duration{ 0 };
+    std::chrono::nanoseconds total_refill_duration{ 0 };
+    std::chrono::nanoseconds max_refill_duration{ 0 };
+
+    [[nodiscard]] inline std::chrono::nanoseconds mean_refill_duration() const
+    {
+        if (nb_produced_blocks == 0)
+            return std::chrono::nanoseconds(0);
+        return total_refill_duration / static_cast<int64_t>(nb_produced_blocks);
+    }
+};
+
+// Keeps a ring of blocks filled in advance by a range engine running in a background thread. A consumer acquires
+// a ready block, reads it, and gives it back to the producer by destroying its handle: the hot path is a pop from a
+// lock-free queue. The blocks are generated in sequence by the range engine, and a single consumer receives them in
+// this order, so the output of a seed is reproducible. The block handles must not outlive their producer.
+template <RandomNumberRangeGenerator RangeEngineT = xoron64_range_engine<>>
+class block_producer
+{
+public:
+    using range_engine_type = RangeEngineT;
+    using integer_type = typename range_engine_type::integer_type;
+
+    // Ready block, given back to the producer when the handle is destroyed (which must happen before the destruction
+    // of the producer).
+    class block_handle
+    {
+    public:
+        block_handle(block_handle&& other) noexcept
+            : producer_(std::exchange(other.producer_, nullptr)), index_(other.index_)
+        {
+        }
+
+        block_handle& operator=(block_handle&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                producer_ = std::exchange(other.producer_, nullptr);
+                index_ = other.index_;
+            }
+            return *this;
+        }
+
+        ~block_handle() { release(); }
+
+        [[nodiscard]] inline std::span<const integer_type> integers() const { return producer_->block_(index_); }
+        [[nodiscard]] inline std::span<const std::byte> bytes() const { return std::as_bytes(integers()); }
+
+        // Gives the block back to the producer before the destruction of the handle.
+        void release()
+        {
+            if (producer_)
+                std::exchange(producer_, nullptr)->release_(index_);
+        }
+
+    private:
+        friend class block_producer;
+
+        block_handle(block_producer& producer, uint32_t index) : producer_(&producer), index_(index) {}
+
+        block_producer* producer_;
+        uint32_t index_;
+    };
+
+    block_producer(range_engine_type range_engine, std::size_t block_bytes, std::size_t nb_blocks);
+
+    block_producer(integer_type seed, std::size_t block_bytes = 1024 * 1024, std::size_t nb_blocks = 4)
+        : block_producer(range_engine_type(seed), block_bytes, nb_blocks)
+    {
+    }
+
+    block_producer(const block_producer&) = delete;
+    block_producer& operator=(const block_producer&) = delete;
+
+    ~block_producer();
+
+    // Waits for a ready block, counting a stall when there is none.
+    [[nodiscard]] block_handle acquire();
+
+    [[nodiscard]] std::optional<block_handle> try_acquire();
+
+    [[nodiscard]] inline std::size_t block_size() const { return block_size_; }
+    [[nodiscard]] inline std::size_t number_of_blocks() const { return nb_blocks_; }
+
+    [[nodiscard]] block_producer_metrics metrics() const;
+
+private:
+    inline std::span<integer_type> block_(uint32_t index) const
+    {
+        return std::span(storage_.get() + index * block_size_, block_size_);
+    }
+
+    void release_(uint32_t index);
+    void produce_(std::stop_token stop_token);
+
+private:
+    range_engine_type range_engine_;
+    std::size_t block_size_;
+    std::size_t nb_blocks_;
+    std::unique_ptr<integer_type[]> storage_;
+    private_::block_index_ring_ free_blocks_;
+    private_::block_index_ring_ ready_blocks_;
+    // Counters waited on with atomic wait / notify when a ring is empty.
+    alignas(64) std::atomic<uint32_t> nb_free_events_ = 0;
+    alignas(64) std::atomic<uint32_t> nb_ready_events_ = 0;
+
+    std::atomic<uint64_t> nb_produced_blocks_ = 0;
+    std::atomic<uint64_t> nb_acquired_blocks_ = 0;
+    std::atomic<uint64_t> nb_stalls_ = 0;
+    std::atomic<int64_t> total_stall_ns_ = 0;
+    std::atomic<int64_t> total_refill_ns_ = 0;
+    std::atomic<int64_t> max_refill_ns_ = 0;
+
+    std::jthread thread_;
+};
+
+template <RandomNumberRangeGenerator RangeEngineT>
+block_producer<RangeEngineT>::block_producer(range_engine_type range_engine, std::size_t block_bytes,
+                                             std::size_t nb_blocks)
+    : range_engine_(std::move(range_engine)), block_size_(block_bytes / sizeof(integer_type)), nb_blocks_(nb_blocks),
+      storage_(new integer_type[block_size_ * nb_blocks_]), free_blocks_(nb_blocks_), ready_blocks_(nb_blocks_)
+{
+    assert(block_size_ > 0 && nb_blocks_ > 0 && block_bytes % sizeof(integer_type) == 0);
+    for (uint32_t i = 0; i < nb_blocks_; ++i)
+        free_blocks_.try_push(i);
+    thread_ = std::jthread([this](std::stop_token stop_token) { produce_(stop_token); });
+}
+
+template <RandomNumberRangeGenerator RangeEngineT>
+block_producer<RangeEngineT>::~block_producer()
+{
+    thread_.request_stop();
+    nb_free_events_.fetch_add(1, std::memory_order_release);
+    nb_free_events_.notify_one();
+}
+
+template <RandomNumberRangeGenerator RangeEngineT>
+void block_producer<RangeEngineT>::produce_(std::stop_token stop_token)
+{
+    while (!stop_token.stop_requested())
+    {
+        const uint32_t nb_free_events = nb_free_events_.load(std::memory_order_acquire);
+        const std::optional<uint32_t> index = free_blocks_.try_pop();
+        if (!index)
+        {
+            // The stop may have been requested (and notified) since the last check: the counter loaded after the
+            // increment of the destructor would never change again.
+            if (stop_token.stop_requested())
+                break;
+            nb_free_events_.wait(nb_free_events, std::memory_order_acquire);
+            continue;
+        }
+
+        const auto start_time_point = std::chrono::steady_clock::now();
+        range_engine_(std::as_writable_bytes(block_(*index)), cppx::endianness_specific);
+        const int64_t refill_ns = std::chrono::nanoseconds(std::chrono::steady_clock::now() - start_time_point).count();
+        total_refill_ns_.fetch_add(refill_ns, std::memory_order_relaxed);
+        int64_t max_refill_ns = max_refill_ns_.load(std::memory_order_relaxed);
+        while (refill_ns > max_refill_ns
+               && !max_refill_ns_.compare_exchange_weak(max_refill_ns, refill_ns, std::memory_order_relaxed))
+        {
+        }
+        nb_produced_blocks_.fetch_add(1, std::memory_order_relaxed);
+
+        ready_blocks_.try_push(*index);
+        nb_ready_events_.fetch_add(1, std::memory_order_release);
+        nb_ready_events_.notify_all();
+    }
+}
+
+template <RandomNumberRangeGenerator RangeEngineT>
+void block_producer<RangeEngineT>::release_(uint32_t index)
+{
+    free_blocks_.try_push(index);
+    nb_free_events_.fetch_add(1, std::memory_order_release);
+    nb_free_events_.notify_one();
+}
+
+template <RandomNumberRangeGenerator RangeEngineT>
+auto block_producer<RangeEngineT>::try_acquire() -> std::optional<block_handle>
+{
+    if (const std::optional<uint32_t> index = ready_blocks_.try_pop())
+    {
+        nb_acquired_blocks_.fetch_add(1, std::memory_order_relaxed);
+        return block_handle(*this, *index);
+    }
+    return std::nullopt;
+}
+
+template <RandomNumberRangeGenerator RangeEngineT>
+auto block_producer<RangeEngineT>::acquire() -> block_handle
+{
+    if (std::optional<block_handle> handle = try_acquire()) [[likely]]
+        return std::move(*handle);
+
+    nb_stalls_.fetch_add(1, std::memory_order_relaxed);
+    const auto start_time_point = std::chrono::steady_clock::now();
+    for (;;)
+    {
+        const uint32_t nb_ready_events = nb_ready_events_.load(std::memory_order_acquire);
+        if (std::optional<block_handle> handle = try_acquire())
+        {
+            const std::chrono::nanoseconds stall_duration = std::chrono::steady_clock::now() - start_time_point;
+            total_stall_ns_.fetch_add(stall_duration.count(), std::memory_order_relaxed);
+            return std::move(*handle);
+        }
+        nb_ready_events_.wait(nb_ready_events, std::memory_order_acquire);
+    }
+}
+
+template <RandomNumberRangeGenerator RangeEngineT>
+block_producer_metrics block_producer<RangeEngineT>::metrics() const
+{
+    return block_producer_metrics{
+        .nb_produced_blocks = nb_produced_blocks_.load(std::memory_order_relaxed),
+        .nb_acquired_blocks = nb_acquired_blocks_.load(std::memory_order_relaxed),
+        .nb_stalls = nb_stalls_.load(std::memory_order_relaxed),
+        .total_stall_duration = std::chrono::nanoseconds(total_stall_ns_.load(std::memory_order_relaxed)),
+        .total_refill_duration = std::chrono::nanoseconds(total_refill_ns_.load(std::memory_order_relaxed)),
+        .max_refill_duration = std::chrono::nanoseconds(max_refill_ns_.load(std::memory_order_relaxed)),
+    };
+}
+
+} // namespace rand
+} // namespace arba
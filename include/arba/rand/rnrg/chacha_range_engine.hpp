@@ -0,0 +1,197 @@
+#pragma once
+
+#include <arba/rand/algorithm/counter_based_fill.hpp>
+#include <arba/rand/chacha.hpp>
+#include <arba/rand/simd/chacha_kernels.hpp>
+#include <arba/rand/xoshiro.hpp>
+
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <span>
+
+#if __has_include(<pthread.h>)
+#include <pthread.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+struct chacha_stream_key_
+{
+    chacha_key key;
+    uint64_t nonce;
+};
+
+template <unsigned Rounds>
+struct chacha_generator_
+{
+    using word_type = uint32_t;
+    using key_type = chacha_stream_key_;
+    using block_type = chacha_block;
+    static constexpr std::size_t block_size = 16;
+
+    static constexpr block_type block(uint64_t block_index, const key_type& key)
+    {
+        return chacha<Rounds>(key.key, block_index, key.nonce);
+    }
+
+    static std::size_t blocks_simd(uint64_t first_block_index, const key_type& key, std::span<word_type> words,
+                                   cppx::EndiannessPolicy auto ep)
+    {
+        return chacha_blocks_simd_<Rounds>(key.key, key.nonce, first_block_index, words, ep);
+    }
+};
+
+// Number of forks the current process descends from (since the first call): a change tells an engine that its state
+// is shared with its parent process.
+inline uint64_t fork_generation_()
+{
+#if __has_include(<pthread.h>)
+    static std::atomic<uint64_t> generation = 0;
+    [[maybe_unused]] static const int registration =
+        pthread_atfork(nullptr, nullptr, [] { generation.fetch_add(1, std::memory_order_relaxed); });
+    return generation.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+// Overwrites an object with zeros, the volatile writes not being removed as dead stores.
+template <class T>
+void secure_wipe_(T& object)
+{
+    volatile unsigned char* bytes = reinterpret_cast<volatile unsigned char*>(&object);
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+        bytes[i] = 0;
+}
+
+} // namespace private_
+
+// Cryptographically secure range engine: the ChaCha keystream (Rounds is 20, 12 or 8, trading security margin for
+// speed) of a 256-bit key and a 64-bit nonce, generated by the SIMD kernels, in parallel with the execution policy.
+// After each request, the key is replaced by the next keystream block and the counter restarts (fast key erasure):
+// the bytes already generated cannot be recovered from the state of the engine.
+// A default-constructed engine takes its key and nonce from std::random_device, and takes new ones at the first request
+// following a fork in the child process, which must not reproduce the bytes of its parent.
+// With endianness_specific, the bytes are the ChaCha keystream on little-endian hosts.
+template <unsigned Rounds = 20>
+    requires(Rounds == 8 || Rounds == 12 || Rounds == 20)
+class chacha_range_engine
+{
+public:
+    using integer_type = uint32_t;
+    using key_type = chacha_key;
+    static constexpr unsigned rounds = Rounds;
+
+    chacha_range_engine() { reseed(); }
+
+    // Reproducible engine, for tests and benchmarks only: its key is as predictable as the seed.
+    inline explicit chacha_range_engine(uint64_t seed_value) { seed(seed_value); }
+
+    inline chacha_range_engine(const key_type& key, uint64_t nonce) { seed(key, nonce); }
+
+    // Copies would generate the same bytes.
+    chacha_range_engine(const chacha_range_engine&) = delete;
+    chacha_range_engine& operator=(const chacha_range_engine&) = delete;
+
+    ~chacha_range_engine() { private_::secure_wipe_(stream_key_); }
+
+    // Key and nonce expanded from the seed with splitmix64 (not reseeded after a fork).
+    void seed(uint64_t value)
+    {
+        key_type key;
+        for (std::size_t i = 0; i < key.size(); i += 2)
+        {
+            const uint64_t word = private_::splitmix64_next_(value);
+            key[i] = uint32_t(word);
+            key[i + 1] = uint32_t(word >> 32);
+        }
+        seed(key, private_::splitmix64_next_(value));
+        private_::secure_wipe_(key);
+    }
+
+    // Explicit key and nonce (not reseeded after a fork).
+    void seed(const key_type& key, uint64_t nonce)
+    {
+        stream_key_ = { key, nonce };
+        position_ = 0;
+        reseeds_after_fork_ = false;
+    }
+
+    // Key and nonce from std::random_device, new ones being taken after a fork.
+    void reseed()
+    {
+        std::random_device random_device;
+        for (uint32_t& word : stream_key_.key)
+            word = random_device();
+        stream_key_.nonce = (uint64_t(random_device()) << 32) | random_device();
+        position_ = 0;
+        reseeds_after_fork_ = true;
+        seed_fork_generation_ = private_::fork_generation_();
+    }
+
+    // Skips values of the current keystream.
+    inline void discard(unsigned long long times) { position_ += times; }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy)
+    {
+        if (reseeds_after_fork_ && seed_fork_generation_ != private_::fork_generation_()) [[unlikely]]
+            reseed();
+        private_::counter_based_fill_<generator_type_>(bytes, stream_key_, position_, endianness_policy,
+                                                       execution_policy);
+        position_ += (bytes.size() + sizeof(integer_type) - 1) / sizeof(integer_type);
+        rekey_();
+        return bytes;
+    }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(bytes, endianness_policy, std::execution::seq);
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(integers, endianness_policy, std::execution::seq);
+    }
+
+private:
+    using generator_type_ = private_::chacha_generator_<Rounds>;
+    static constexpr std::size_t block_size_ = generator_type_::block_size;
+
+    // The key becomes the first words of the block following the generated ones.
+    void rekey_()
+    {
+        chacha_block block = generator_type_::block((position_ + block_size_ - 1) / block_size_, stream_key_);
+        std::copy_n(block.cbegin(), stream_key_.key.size(), stream_key_.key.begin());
+        private_::secure_wipe_(block);
+        position_ = 0;
+    }
+
+private:
+    private_::chacha_stream_key_ stream_key_;
+    uint64_t position_ = 0;
+    uint64_t seed_fork_generation_ = 0;
+    bool reseeds_after_fork_ = false;
+};
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <arba/rand/algorithm/counter_based_fill.hpp>
+
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <cstdint>
+#include <random>
+#include <span>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// Range engine over a counter-based generator: a request of n bytes writes the values from the position on, and
+// moves the position ceil(n / sizeof(integer_type)) values forward: the bytes left of a partial last value are dropped.
+// The values are computed block by block without any state: the output does not depend on the execution policy, nor
+// on how the requests are cut as long as they are multiples of sizeof(integer_type).
+template <class GeneratorT>
+class counter_based_range_engine_
+{
+public:
+    using integer_type = typename GeneratorT::word_type;
+    using key_type = typename GeneratorT::key_type;
+
+    inline explicit counter_based_range_engine_(uint64_t seed_value) : key_(GeneratorT::key_from_seed(seed_value)) {}
+
+    inline explicit counter_based_range_engine_(const key_type& key) : key_(key) {}
+
+    counter_based_range_engine_() : counter_based_range_engine_(uint64_t(std::random_device{}())) {}
+
+    // Sets the key derived from the seed and restarts at index 0.
+    inline void seed(uint64_t value) { *this = counter_based_range_engine_(value); }
+
+    [[nodiscard]] inline const key_type& key() const { return key_; }
+
+    // Index of the next value.
+    [[nodiscard]] inline uint64_t position() const { return position_; }
+
+    inline void set_position(uint64_t index) { position_ = index; }
+
+    inline void discard(unsigned long long times) { position_ += times; }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy)
+    {
+        counter_based_fill_<GeneratorT>(bytes, key_, position_, endianness_policy, execution_policy);
+        position_ += (bytes.size() + sizeof(integer_type) - 1) / sizeof(integer_type);
+        return bytes;
+    }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(bytes, endianness_policy, std::execution::seq);
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(integers, endianness_policy, std::execution::seq);
+    }
+
+private:
+    key_type key_;
+    uint64_t position_ = 0;
+};
+
+} // namespace private_
+
+// Range engine of the Philox4x32 values (see philox4x32_fill).
+template <unsigned Rounds = 10>
+using philox4x32_range_engine = private_::counter_based_range_engine_<private_::philox4x32_generator_<Rounds>>;
+
+// Range engine of the Threefry2x64 values (see threefry2x64_fill).
+template <unsigned Rounds = 20>
+using threefry2x64_range_engine = private_::counter_based_range_engine_<private_::threefry2x64_generator_<Rounds>>;
+
+} // namespace rand
+} // namespace arba
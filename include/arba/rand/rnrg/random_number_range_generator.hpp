@@ -0,0 +1,70 @@
+#pragma once
+
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Engine filling whole ranges of bytes at once (xorshift64_range_engine, xoron64_range_engine, ...).
+template <class RnrgT>
+concept RandomNumberRangeGenerator = requires(RnrgT& rnrg, std::span<std::byte> bytes) {
+    typename RnrgT::integer_type;
+    requires std::unsigned_integral<typename RnrgT::integer_type>;
+    rnrg(bytes, cppx::endianness_specific);
+};
+
+namespace private_
+{
+
+// Fills the bytes with the execution policy when the engine supports one.
+template <RandomNumberRangeGenerator RnrgT>
+inline void rnrg_fill_(RnrgT& rnrg, std::span<std::byte> bytes, cppx::ExecutionPolicy auto execution_policy)
+{
+    if constexpr (requires { rnrg(bytes, cppx::endianness_specific, execution_policy); })
+        rnrg(bytes, cppx::endianness_specific, execution_policy);
+    else
+        rnrg(bytes, cppx::endianness_specific);
+}
+
+// Uniform random bit generator drawing its values from a buffer refilled by a range engine. Handy to serve the
+// few extra values needed after a bulk fill (rejections, slow paths, ...).
+template <std::unsigned_integral UintT, RandomNumberRangeGenerator RnrgT, std::size_t BufferSize = 64>
+class rnrg_word_source_
+{
+public:
+    using result_type = UintT;
+
+    explicit rnrg_word_source_(RnrgT& rnrg) : rnrg_(rnrg) {}
+
+    static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        if (index_ == BufferSize) [[unlikely]]
+        {
+            rnrg_(std::as_writable_bytes(std::span(words_)), cppx::endianness_specific);
+            index_ = 0;
+        }
+        return words_[index_++];
+    }
+
+private:
+    RnrgT& rnrg_;
+    std::array<UintT, BufferSize> words_;
+    std::size_t index_ = BufferSize;
+};
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
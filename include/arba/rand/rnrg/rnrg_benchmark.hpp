@@ -1,17 +1,25 @@
 #pragma once
 
+#include <arba/rand/algorithm/count_distinct.hpp>
+#include <arba/rand/statistical_tests.hpp>
+
 #include <arba/core/container/span.hpp>
 #include <arba/cppx/policy/endianness_policy.hpp>
 #include <arba/cppx/policy/execution_policy.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <concepts>
 #include <cstdint>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <span>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 inline namespace arba
@@ -30,9 +38,14 @@ public:
     std::vector<double> homogeneous_byte_distribution_indexes;
     std::vector<double> integer_uniqueness_indexes;
     std::vector<double> execution_durations;
+    // Durations of the computation of the indexes, not included in the execution durations.
+    std::vector<double> measurement_durations;
+    // Results of each statistical test for each seed, indexed by the test (NaN when it is not computed).
+    std::array<std::vector<statistical_test_result>, nb_statistical_tests> statistical_test_results;
     double average_homogeneous_byte_distribution_index = std::numeric_limits<double>::quiet_NaN();
     double average_integer_uniqueness_index = std::numeric_limits<double>::quiet_NaN();
     double average_execution_duration = std::numeric_limits<double>::quiet_NaN();
+    double average_measurement_duration = std::numeric_limits<double>::quiet_NaN();
 
     void reserve(std::size_t nb_seeds)
     {
@@ -40,9 +53,30 @@ public:
         homogeneous_byte_distribution_indexes.reserve(nb_seeds);
         integer_uniqueness_indexes.reserve(nb_seeds);
         execution_durations.reserve(nb_seeds);
+        measurement_durations.reserve(nb_seeds);
+        for (std::vector<statistical_test_result>& results : statistical_test_results)
+            results.reserve(nb_seeds);
+    }
+
+    [[nodiscard]] inline const std::vector<statistical_test_result>& results_of(statistical_test test) const
+    {
+        return statistical_test_results[std::size_t(test)];
     }
 };
 
+namespace private_
+{
+
+// Buffers of a seed being measured: its range, and the scratch buffer of the exact count of distinct integers.
+template <typename IntegerT>
+struct rnrg_benchmark_workspace_
+{
+    std::vector<std::byte> bytes;
+    std::vector<distinct_mix_t<IntegerT>> scratch;
+};
+
+} // namespace private_
+
 class rnrg_benchmark
 {
 public:
@@ -52,6 +86,31 @@ public:
 
     bool compute_homogeneous_byte_distribution_index : 1 = true;
     bool compute_integer_uniqueness_index : 1 = true;
+    // Estimates the uniqueness index with a HyperLogLog sketch (relative error about 0.4%), in one pass over the range
+    // and without the scratch buffer of the exact count.
+    bool approximate_integer_uniqueness_index : 1 = false;
+    // Measures several seeds at the same time, distributed with the execution policy, each one with its own copy of
+    // the engine (a default-constructed engine when it is not copyable) and its own buffers: as many as fit in
+    // parallel_seeds_memory_budget, at most max_parallel_seeds (the number of hardware threads when 0). Faster, but
+    // the durations of the seeds include the contention between them: keep the default sequential mode for clean
+    // durations.
+    bool parallel_seeds : 1 = false;
+    // Statistical tests of the range, each one distributed with the execution policy (see statistical_tests.hpp).
+    // Their durations are included in the measurement durations.
+    bool compute_chi_square_bytes_test : 1 = false;
+    bool compute_chi_square_words16_test : 1 = false;
+    bool compute_monobit_test : 1 = false;
+    bool compute_runs_test : 1 = false;
+    bool compute_serial_correlation_test : 1 = false;
+    bool compute_entropy_test : 1 = false;
+    bool compute_gap_test : 1 = false;
+    bool compute_birthday_spacings_test : 1 = false;
+    std::size_t parallel_seeds_memory_budget = std::size_t(4) * 1024 * 1024 * 1024;
+    std::size_t max_parallel_seeds = 0;
+
+    // Called with the index of the seed and the generated range, after the computation of the indexes, which do not
+    // modify it: e.g. to check the determinism of an engine, or to dump its output.
+    std::function<void(std::size_t, std::span<const std::byte>)> range_inspector = nullptr;
 
     template <class RnrgT, std::ranges::range SeedRangeT>
         requires(std::convertible_to<std::ranges::range_value_t<SeedRangeT>, typename RnrgT::integer_type>)
@@ -86,52 +145,67 @@ public:
             cppx::EndiannessPolicy auto endianness_policy, cppx::ExecutionPolicy auto execution_policy) const
     {
         using integer_t = typename RnrgT::integer_type;
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+        constexpr bool is_sequenced =
+            std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>;
 
         assert(range_byte_size > 0);
-        std::vector<std::byte> bytes(range_byte_size, std::byte{ 0 });
-
         rnrg_benchmark_result<std::ranges::range_value_t<SeedRangeT>> bm_res;
         bm_res.range_byte_size = range_byte_size;
         bm_res.reserve(seeds.size());
-        std::array<std::size_t, 256> byte_counters;
-        const std::span ints = core::as_writable_span<integer_t>(std::span(bytes));
         for (auto seed : seeds)
-        {
-            rnrg.seed(seed);
             bm_res.seeds.push_back(seed);
-            std::ranges::fill(bytes, std::byte{ 0 });
+        const std::size_t nb_seeds = bm_res.seeds.size();
+        bm_res.homogeneous_byte_distribution_indexes.assign(nb_seeds, nan);
+        bm_res.integer_uniqueness_indexes.assign(nb_seeds, nan);
+        bm_res.execution_durations.assign(nb_seeds, nan);
+        bm_res.measurement_durations.assign(nb_seeds, nan);
+        for (std::vector<statistical_test_result>& results : bm_res.statistical_test_results)
+            results.assign(nb_seeds, statistical_test_result{});
 
-            const time_point_type start_time_point = clock_type::now();
-            if constexpr (requires { rnrg(std::span(bytes), endianness_policy, execution_policy); })
-                rnrg(std::span(bytes), endianness_policy, execution_policy);
-            else
-                rnrg(std::span(bytes), endianness_policy);
-            const duration_type duration =
-                std::chrono::duration_cast<duration_type>(clock_type::now() - start_time_point);
-            bm_res.execution_durations.push_back(duration.count());
-
-            if (compute_homogeneous_byte_distribution_index)
-            {
-                byte_counters.fill(0);
-                for (std::byte val : bytes)
-                    ++byte_counters[static_cast<uint8_t>(val)];
-                const auto min_iter = std::ranges::min_element(byte_counters);
-                const auto max_iter = std::ranges::max_element(byte_counters);
-                const double homogeneous_byte_distribution_index = 1. - double(*max_iter - *min_iter) / bytes.size();
-                bm_res.homogeneous_byte_distribution_indexes.push_back(homogeneous_byte_distribution_index);
-            }
-            else
-                bm_res.homogeneous_byte_distribution_indexes.push_back(std::numeric_limits<double>::quiet_NaN());
-
-            if (compute_integer_uniqueness_index)
-            {
-                std::sort(ints.begin(), ints.end());
-                const auto uniq_iter = std::unique(ints.begin(), ints.end());
-                const double integer_uniqueness_index = std::distance(ints.begin(), uniq_iter) / double(ints.size());
-                bm_res.integer_uniqueness_indexes.push_back(integer_uniqueness_index);
-            }
+        // Each seed measured at the same time has its own engine and buffers, reused by the next seeds.
+        const bool exact_uniqueness = compute_integer_uniqueness_index && !approximate_integer_uniqueness_index;
+        const std::size_t scratch_size = exact_uniqueness ? range_byte_size / sizeof(integer_t) : 0;
+        const std::size_t seed_memory = range_byte_size + scratch_size * sizeof(distinct_mix_t<integer_t>);
+        const std::size_t nb_threads =
+            max_parallel_seeds > 0 ? max_parallel_seeds : std::max(std::thread::hardware_concurrency(), 1u);
+        const std::size_t max_nb_concurrent_seeds = std::clamp<std::size_t>(nb_seeds, 1, nb_threads);
+        const std::size_t nb_concurrent_seeds =
+            (parallel_seeds && !is_sequenced)
+                ? std::clamp<std::size_t>(parallel_seeds_memory_budget / seed_memory, 1, max_nb_concurrent_seeds)
+                : 1;
+
+        std::vector<private_::rnrg_benchmark_workspace_<integer_t>> workspaces(nb_concurrent_seeds);
+        for (auto& workspace : workspaces)
+        {
+            workspace.bytes.assign(range_byte_size, std::byte{ 0 });
+            workspace.scratch.resize(scratch_size);
+        }
+        std::vector<std::unique_ptr<RnrgT>> engine_copies;
+        std::vector<RnrgT*> engines{ &rnrg };
+        for (std::size_t i = 1; i < nb_concurrent_seeds; ++i)
+        {
+            if constexpr (std::copy_constructible<RnrgT>)
+                engine_copies.push_back(std::make_unique<RnrgT>(rnrg));
             else
-                bm_res.integer_uniqueness_indexes.push_back(std::numeric_limits<double>::quiet_NaN());
+                engine_copies.push_back(std::make_unique<RnrgT>());
+            engines.push_back(engine_copies.back().get());
+        }
+
+        std::vector<std::size_t> slots(nb_concurrent_seeds);
+        std::iota(slots.begin(), slots.end(), 0);
+        for (std::size_t first_seed_index = 0; first_seed_index < nb_seeds; first_seed_index += nb_concurrent_seeds)
+        {
+            const std::size_t nb_batch_seeds = std::min(nb_concurrent_seeds, nb_seeds - first_seed_index);
+            std::for_each(execution_policy, slots.cbegin(), slots.cbegin() + nb_batch_seeds,
+                          [&](std::size_t slot)
+                          {
+                              measure_seed_(*engines[slot], first_seed_index + slot, workspaces[slot],
+                                            endianness_policy, execution_policy, bm_res);
+                          });
+            if (range_inspector)
+                for (std::size_t slot = 0; slot < nb_batch_seeds; ++slot)
+                    range_inspector(first_seed_index + slot, workspaces[slot].bytes);
         }
 
         // clang-format off
@@ -146,10 +220,96 @@ public:
         bm_res.average_execution_duration =
             std::reduce(bm_res.execution_durations.cbegin(),
                         bm_res.execution_durations.cend()) / seeds.size();
+        bm_res.average_measurement_duration =
+            std::reduce(bm_res.measurement_durations.cbegin(),
+                        bm_res.measurement_durations.cend()) / seeds.size();
         // clang-format on
 
         return bm_res;
     }
+
+    // Enables or disables all the statistical tests.
+    void compute_statistical_tests(bool enabled)
+    {
+        compute_chi_square_bytes_test = enabled;
+        compute_chi_square_words16_test = enabled;
+        compute_monobit_test = enabled;
+        compute_runs_test = enabled;
+        compute_serial_correlation_test = enabled;
+        compute_entropy_test = enabled;
+        compute_gap_test = enabled;
+        compute_birthday_spacings_test = enabled;
+    }
+
+    [[nodiscard]] bool is_computed(statistical_test test) const
+    {
+        switch (test)
+        {
+        case statistical_test::chi_square_bytes:
+            return compute_chi_square_bytes_test;
+        case statistical_test::chi_square_words16:
+            return compute_chi_square_words16_test;
+        case statistical_test::monobit:
+            return compute_monobit_test;
+        case statistical_test::runs:
+            return compute_runs_test;
+        case statistical_test::serial_correlation:
+            return compute_serial_correlation_test;
+        case statistical_test::entropy:
+            return compute_entropy_test;
+        case statistical_test::gap:
+            return compute_gap_test;
+        default:
+            return compute_birthday_spacings_test;
+        }
+    }
+
+private:
+    // Generates the range of the seed in the buffer of the workspace, then computes its indexes.
+    template <class RnrgT, typename SeedT>
+    void measure_seed_(RnrgT& rnrg, std::size_t seed_index,
+                       private_::rnrg_benchmark_workspace_<typename RnrgT::integer_type>& workspace,
+                       cppx::EndiannessPolicy auto endianness_policy, cppx::ExecutionPolicy auto execution_policy,
+                       rnrg_benchmark_result<SeedT>& bm_res) const
+    {
+        using integer_t = typename RnrgT::integer_type;
+
+        const std::span bytes(workspace.bytes);
+        rnrg.seed(bm_res.seeds[seed_index]);
+        const time_point_type start_time_point = clock_type::now();
+        if constexpr (requires { rnrg(bytes, endianness_policy, execution_policy); })
+            rnrg(bytes, endianness_policy, execution_policy);
+        else
+            rnrg(bytes, endianness_policy);
+        const duration_type duration = std::chrono::duration_cast<duration_type>(clock_type::now() - start_time_point);
+        bm_res.execution_durations[seed_index] = duration.count();
+
+        const time_point_type measurement_start_time_point = clock_type::now();
+        if (compute_homogeneous_byte_distribution_index)
+        {
+            const std::array<uint64_t, 256> byte_counters = byte_counts(bytes, execution_policy);
+            const auto min_iter = std::ranges::min_element(byte_counters);
+            const auto max_iter = std::ranges::max_element(byte_counters);
+            bm_res.homogeneous_byte_distribution_indexes[seed_index] =
+                1. - double(*max_iter - *min_iter) / bytes.size();
+        }
+
+        if (compute_integer_uniqueness_index)
+        {
+            const std::span<const integer_t> ints = core::as_writable_span<integer_t>(bytes);
+            bm_res.integer_uniqueness_indexes[seed_index] =
+                approximate_integer_uniqueness_index
+                    ? std::min(approximate_count_distinct(ints, execution_policy) / double(ints.size()), 1.)
+                    : count_distinct(ints, std::span(workspace.scratch), execution_policy) / double(ints.size());
+        }
+
+        for (const statistical_test test : statistical_tests)
+            if (is_computed(test))
+                bm_res.statistical_test_results[std::size_t(test)][seed_index] =
+                    run_statistical_test(test, bytes, execution_policy);
+        bm_res.measurement_durations[seed_index] =
+            std::chrono::duration_cast<duration_type>(clock_type::now() - measurement_start_time_point).count();
+    }
 };
 
 } // namespace rand
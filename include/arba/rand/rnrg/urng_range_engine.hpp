@@ -0,0 +1,145 @@
+#pragma once
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Range engine writing the successive values of a uniform random bit generator of 32 or 64 full bits: the bytes are
+// the values of the generator in sequence. When the generator jumps ahead in O(log(n)) with advance() (PCG engines),
+// the blocks of a parallel request are generated by copies of the generator advanced to their positions, so that the
+// output does not depend on the execution policy. Otherwise, the requests are generated sequentially.
+template <std::uniform_random_bit_generator UrngT>
+    requires(std::is_same_v<typename UrngT::result_type, uint32_t>
+             || std::is_same_v<typename UrngT::result_type, uint64_t>)
+            && (UrngT::min() == 0 && UrngT::max() == std::numeric_limits<typename UrngT::result_type>::max())
+class urng_range_engine
+{
+public:
+    using urng_type = UrngT;
+    using integer_type = typename urng_type::result_type;
+
+    static constexpr std::size_t parallel_block_size = (1024 * 1024) / sizeof(integer_type);
+
+    // Constructs the generator from the arguments (seed, stream id...).
+    template <class... ArgsT>
+        requires std::constructible_from<urng_type, ArgsT...>
+    inline explicit urng_range_engine(ArgsT&&... args) : urng_(std::forward<ArgsT>(args)...)
+    {
+    }
+
+    // Seeds the generator with the arguments of its own seed(): a 64-bit seed is kept whole for pcg32_engine.
+    template <class... ArgsT>
+        requires requires(urng_type& urng, ArgsT&&... args) { urng.seed(std::forward<ArgsT>(args)...); }
+    inline void seed(ArgsT&&... args)
+    {
+        urng_.seed(std::forward<ArgsT>(args)...);
+    }
+
+    inline void discard(unsigned long long times) { urng_.discard(times); }
+
+    [[nodiscard]] inline const urng_type& urng() const { return urng_; }
+    [[nodiscard]] inline urng_type& urng() { return urng_; }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        const std::span uints = core::as_writable_span<integer_type>(bytes);
+        fill_(urng_, uints, endianness_policy);
+        fill_remaining_bytes_(bytes, endianness_policy);
+        return bytes;
+    }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy);
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy);
+        return integers;
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+private:
+    static void fill_(urng_type& urng, std::span<integer_type> uints, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        std::ranges::generate(uints, [&] { return core::htow_when(integer_type(urng()), endianness_policy); });
+    }
+
+    void fill_remaining_bytes_(std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        if (std::size_t remaining_bytes = bytes.size() & (sizeof(integer_type) - 1); remaining_bytes > 0)
+        {
+            const std::span output_bytes = bytes.last(remaining_bytes);
+            integer_type value = core::htow_when(integer_type(urng_()), endianness_policy);
+            const std::span input_bytes = core::as_writable_bytes(value).first(remaining_bytes);
+            std::ranges::copy(input_bytes, output_bytes.begin());
+        }
+    }
+
+private:
+    urng_type urng_;
+};
+
+template <std::uniform_random_bit_generator UrngT>
+    requires(std::is_same_v<typename UrngT::result_type, uint32_t>
+             || std::is_same_v<typename UrngT::result_type, uint64_t>)
+            && (UrngT::min() == 0 && UrngT::max() == std::numeric_limits<typename UrngT::result_type>::max())
+std::span<std::byte> urng_range_engine<UrngT>::operator()(const std::span<std::byte> bytes,
+                                                          cppx::EndiannessPolicy auto endianness_policy,
+                                                          cppx::ExecutionPolicy auto execution_policy)
+{
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>
+                  || !requires(urng_type& urng) { urng.advance(1); })
+    {
+        return (*this)(bytes, endianness_policy);
+    }
+    else
+    {
+        const std::span uints = core::as_writable_span<integer_type>(bytes);
+        const std::size_t nb_blocks = (uints.size() + parallel_block_size - 1) / parallel_block_size;
+        if (nb_blocks <= 1)
+            return (*this)(bytes, endianness_policy);
+
+        std::vector<std::size_t> block_indexes(nb_blocks);
+        std::iota(block_indexes.begin(), block_indexes.end(), 0);
+        std::for_each(execution_policy, block_indexes.cbegin(), block_indexes.cend(),
+                      [&](std::size_t block_index)
+                      {
+                          const std::size_t offset = block_index * parallel_block_size;
+                          urng_type urng = urng_;
+                          urng.advance(offset);
+                          fill_(urng, uints.subspan(offset, std::min(parallel_block_size, uints.size() - offset)),
+                                endianness_policy);
+                      });
+        urng_.advance(uints.size());
+        fill_remaining_bytes_(bytes, endianness_policy);
+        return bytes;
+    }
+}
+
+} // namespace rand
+} // namespace arba
@@ -14,7 +14,8 @@ namespace rand
 {
 
 template <class InitRnrgT = xorshift64_range_engine<>, std::size_t InitRangeSize = 2048,
-          uint64_t AlphaXorMask = 0xA6B6C6D6A6B6C6A6ull, uint64_t BetaXorMask = 0x6A6B6C6D6A6B6C6Aull>
+          uint64_t AlphaXorMask = 0xA6B6C6D6A6B6C6A6ull, uint64_t BetaXorMask = 0x6A6B6C6D6A6B6C6Aull,
+          std::size_t TileBytes = xoron64_default_tile_bytes>
 class xoron64_range_engine : private InitRnrgT
 {
 public:
@@ -24,6 +25,7 @@ public:
     static constexpr std::size_t init_range_size = InitRangeSize;
     static constexpr integer_type alpha_xor_mask = AlphaXorMask;
     static constexpr integer_type beta_xor_mask = BetaXorMask;
+    static constexpr std::size_t tile_bytes = TileBytes;
 
     inline explicit xoron64_range_engine(integer_type seed_value) : init_range_engine(seed_value) {}
 
@@ -39,7 +41,8 @@ public:
             std::min(init_range_size, (bytes.size() / sizeof(integer_type)) * sizeof(integer_type));
         const std::span<std::byte> init_range = bytes.first(init_rng_size);
         static_cast<init_range_engine&>(*this)(init_range, endianness_policy);
-        return xoron64_fill<init_range_size, alpha_xor_mask, beta_xor_mask>(bytes, endianness_policy, execution_policy);
+        return xoron64_fill<init_range_size, alpha_xor_mask, beta_xor_mask, tile_bytes>(bytes, endianness_policy,
+                                                                                  execution_policy);
     }
 
     std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "xoron64_range_engine.hpp"
+
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <span>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Range engine producing an endless xoron64 stream window by window, with a working set of one window (a few MB,
+// staying in L2/L3) whatever the size of the output: it suits outputs written to files or sockets.
+// Window k of the stream, bytes [k * WindowBytes, (k + 1) * WindowBytes), is the output of the k-th call of a
+// xoron64_range_engine with the same seed and parameters on a span of WindowBytes bytes. The stream does not depend
+// on the sizes of the requests, but all the requests must use the same endianness policy.
+template <class InitRnrgT = xorshift64_range_engine<>, std::size_t WindowBytes = 4 * 1024 * 1024,
+          std::size_t InitRangeSize = 2048, uint64_t AlphaXorMask = 0xA6B6C6D6A6B6C6A6ull,
+          uint64_t BetaXorMask = 0x6A6B6C6D6A6B6C6Aull>
+    requires(WindowBytes >= InitRangeSize && WindowBytes % sizeof(uint64_t) == 0)
+class xoron64_stream_engine
+{
+public:
+    using window_engine_type = xoron64_range_engine<InitRnrgT, InitRangeSize, AlphaXorMask, BetaXorMask>;
+    using integer_type = typename window_engine_type::integer_type;
+
+    static constexpr std::size_t window_bytes = WindowBytes;
+
+    inline explicit xoron64_stream_engine(integer_type seed_value) : window_engine_(seed_value) {}
+
+    xoron64_stream_engine() = default;
+
+    [[nodiscard]] inline integer_type seed() const { return window_engine_.seed(); }
+
+    // Restarts the stream, dropping the rest of the current window.
+    inline void seed(integer_type value)
+    {
+        window_engine_.seed(value);
+        window_index_ = window_bytes;
+    }
+
+    // Next bytes of the stream. The whole windows are generated in place, only the partial ones go through the
+    // window buffer.
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy);
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(bytes, endianness_policy, std::execution::seq);
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(integers, endianness_policy, std::execution::seq);
+    }
+
+    // Passes the next nb_bytes bytes of the stream to the sink, as spans of at most one window.
+    template <class SinkFunctionT>
+    void generate(std::size_t nb_bytes, SinkFunctionT sink, cppx::EndiannessPolicy auto endianness_policy,
+                  cppx::ExecutionPolicy auto execution_policy);
+
+    template <class SinkFunctionT>
+    void generate(std::size_t nb_bytes, SinkFunctionT sink, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        generate(nb_bytes, sink, endianness_policy, std::execution::seq);
+    }
+
+private:
+    // Takes up to max_bytes bytes from the window, generating the next one when it is exhausted.
+    std::span<const std::byte> take_(std::size_t max_bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                     cppx::ExecutionPolicy auto execution_policy)
+    {
+        if (window_index_ == window_bytes)
+        {
+            if (!window_)
+                window_ = std::make_unique_for_overwrite<integer_type[]>(window_bytes / sizeof(integer_type));
+            window_engine_(std::span(window_.get(), window_bytes / sizeof(integer_type)), endianness_policy,
+                           execution_policy);
+            window_index_ = 0;
+        }
+        const std::size_t size = std::min(max_bytes, window_bytes - window_index_);
+        const std::span window = std::as_bytes(std::span(window_.get(), window_bytes / sizeof(integer_type)));
+        const std::span taken_bytes = window.subspan(window_index_, size);
+        window_index_ += size;
+        return taken_bytes;
+    }
+
+private:
+    window_engine_type window_engine_;
+    std::unique_ptr<integer_type[]> window_;
+    std::size_t window_index_ = window_bytes;
+};
+
+template <class InitRnrgT, std::size_t WindowBytes, std::size_t InitRangeSize, uint64_t AlphaXorMask,
+          uint64_t BetaXorMask>
+    requires(WindowBytes >= InitRangeSize && WindowBytes % sizeof(uint64_t) == 0)
+std::span<std::byte>
+xoron64_stream_engine<InitRnrgT, WindowBytes, InitRangeSize, AlphaXorMask, BetaXorMask>::operator()(
+    const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+    cppx::ExecutionPolicy auto execution_policy)
+{
+    std::span<std::byte> remaining_bytes = bytes;
+    if (window_index_ != window_bytes)
+    {
+        const std::span taken_bytes = take_(remaining_bytes.size(), endianness_policy, execution_policy);
+        std::ranges::copy(taken_bytes, remaining_bytes.begin());
+        remaining_bytes = remaining_bytes.subspan(taken_bytes.size());
+    }
+    for (; remaining_bytes.size() >= window_bytes; remaining_bytes = remaining_bytes.subspan(window_bytes))
+        window_engine_(remaining_bytes.first(window_bytes), endianness_policy, execution_policy);
+    if (!remaining_bytes.empty())
+    {
+        const std::span taken_bytes = take_(remaining_bytes.size(), endianness_policy, execution_policy);
+        std::ranges::copy(taken_bytes, remaining_bytes.begin());
+    }
+    return bytes;
+}
+
+template <class InitRnrgT, std::size_t WindowBytes, std::size_t InitRangeSize, uint64_t AlphaXorMask,
+          uint64_t BetaXorMask>
+    requires(WindowBytes >= InitRangeSize && WindowBytes % sizeof(uint64_t) == 0)
+template <class SinkFunctionT>
+void xoron64_stream_engine<InitRnrgT, WindowBytes, InitRangeSize, AlphaXorMask, BetaXorMask>::generate(
+    std::size_t nb_bytes, SinkFunctionT sink, cppx::EndiannessPolicy auto endianness_policy,
+    cppx::ExecutionPolicy auto execution_policy)
+{
+    while (nb_bytes > 0)
+    {
+        const std::span taken_bytes = take_(nb_bytes, endianness_policy, execution_policy);
+        sink(taken_bytes);
+        nb_bytes -= taken_bytes.size();
+    }
+}
+
+} // namespace rand
+} // namespace arba
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <arba/rand/simd/xorshift_lanes.hpp>
 #include <arba/rand/xorshift.hpp>
+#include <arba/rand/xorshift_jump.hpp>
 
 #include <arba/core/bit/htow_when.hpp>
 #include <arba/core/container/span.hpp>
 #include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
 
 #include <algorithm>
 #include <array>
+#include <numeric>
 #include <random>
 #include <span>
+#include <vector>
 
 inline namespace arba
 {
@@ -37,14 +42,15 @@ public:
 
     inline void seed(integer_type value) { state_ = xorshift32_range_engine(value).seed(); }
 
-    inline void discard(unsigned long long times)
-    {
-        for (; times > 0; --times)
-            state_ = xorshift32(state_);
-    }
+    inline void discard(unsigned long long times) { state_ = xorshift32_jump(state_, times); }
 
     std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy);
 
+    // The output is identical to the sequential one: each block starts from the lane states jumped ahead to its
+    // position, so it does not depend on the number of threads.
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy);
+
     std::span<integer_type> operator()(const std::span<integer_type> integers,
                                        cppx::EndiannessPolicy auto endianness_policy)
     {
@@ -52,36 +58,60 @@ public:
         return integers;
     }
 
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+    static constexpr std::size_t parallel_block_size = (1024 * 1024) / (SeedCount * sizeof(integer_type)) * SeedCount;
+
+private:
+    void init_states_(integer_type (&states)[SeedCount]) const;
+    static void fill_(integer_type (&states)[SeedCount], std::span<integer_type> uints,
+                      cppx::EndiannessPolicy auto endianness_policy);
+    void fill_remaining_bytes_(std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy);
+
 private:
     integer_type state_;
 };
 
 template <std::size_t SeedCount, int RotationFactor>
     requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
-std::span<std::byte>
-xorshift32_range_engine<SeedCount, RotationFactor>::operator()(const std::span<std::byte> bytes,
-                                                               cppx::EndiannessPolicy auto endianness_policy)
+void xorshift32_range_engine<SeedCount, RotationFactor>::init_states_(integer_type (&states)[SeedCount]) const
 {
     const std::size_t seed_count = SeedCount;
-    integer_type states[seed_count];
     std::size_t i = 0;
     for (std::size_t end_i = seed_count / 2; i < end_i; ++i)
         states[i] = std::rotl(state_, i * RotationFactor);
     for (std::size_t j = 0; i < seed_count; ++i, ++j)
         states[i] = std::rotr(~state_, j * RotationFactor);
+}
 
-    i = 0;
-    const std::span uints = core::as_writable_span<integer_type>(bytes);
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+void xorshift32_range_engine<SeedCount, RotationFactor>::fill_(integer_type (&states)[SeedCount],
+                                                              std::span<integer_type> uints,
+                                                              cppx::EndiannessPolicy auto endianness_policy)
+{
+    const std::size_t seed_count = SeedCount;
+    std::size_t i = private_::xorshift_lanes_fill_(states, uints, endianness_policy);
     auto xorshift_fn = [&](integer_type& val)
     {
         uint32_t& state = states[i++ % seed_count];
         state = xorshift32(state);
         val = core::htow_when(state, endianness_policy);
     };
-    std::for_each(uints.begin(), uints.end(), xorshift_fn);
-
-    state_ = xorshift32(states[0]);
+    std::for_each(uints.begin() + i, uints.end(), xorshift_fn);
+}
 
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+void xorshift32_range_engine<SeedCount, RotationFactor>::fill_remaining_bytes_(
+    std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+{
     if (std::size_t remaining_bytes = bytes.size() & (sizeof(integer_type) - 1); remaining_bytes > 0)
     {
         const std::span output_bytes = bytes.last(remaining_bytes);
@@ -90,7 +120,56 @@ xorshift32_range_engine<SeedCount, RotationFactor>::operator()(const std::span<s
         std::ranges::copy(input_bytes, output_bytes.begin());
         state_ = xorshift32(state_);
     }
+}
 
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+std::span<std::byte>
+xorshift32_range_engine<SeedCount, RotationFactor>::operator()(const std::span<std::byte> bytes,
+                                                              cppx::EndiannessPolicy auto endianness_policy)
+{
+    integer_type states[SeedCount];
+    init_states_(states);
+    fill_(states, core::as_writable_span<integer_type>(bytes), endianness_policy);
+    state_ = xorshift32(states[0]);
+    fill_remaining_bytes_(bytes, endianness_policy);
+    return bytes;
+}
+
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+std::span<std::byte>
+xorshift32_range_engine<SeedCount, RotationFactor>::operator()(const std::span<std::byte> bytes,
+                                                              cppx::EndiannessPolicy auto endianness_policy,
+                                                              cppx::ExecutionPolicy auto execution_policy)
+{
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>)
+        return (*this)(bytes, endianness_policy);
+
+    const std::span uints = core::as_writable_span<integer_type>(bytes);
+    const std::size_t nb_blocks = (uints.size() + parallel_block_size - 1) / parallel_block_size;
+    if (nb_blocks <= 1)
+        return (*this)(bytes, endianness_policy);
+
+    integer_type init_states[SeedCount];
+    init_states_(init_states);
+    std::vector<std::size_t> block_indexes(nb_blocks);
+    std::iota(block_indexes.begin(), block_indexes.end(), 0);
+    std::for_each(execution_policy, block_indexes.cbegin(), block_indexes.cend(),
+                  [&](std::size_t block_index)
+                  {
+                      const unsigned long long nb_rounds = block_index * (parallel_block_size / SeedCount);
+                      integer_type states[SeedCount];
+                      for (std::size_t i = 0; i < SeedCount; ++i)
+                          states[i] = xorshift32_jump(init_states[i], nb_rounds);
+                      const std::size_t offset = block_index * parallel_block_size;
+                      fill_(states, uints.subspan(offset, std::min(parallel_block_size, uints.size() - offset)),
+                            endianness_policy);
+                  });
+
+    // The first lane is advanced once per started round.
+    state_ = xorshift32(xorshift32_jump(init_states[0], (uints.size() + SeedCount - 1) / SeedCount));
+    fill_remaining_bytes_(bytes, endianness_policy);
     return bytes;
 }
 
@@ -146,14 +225,15 @@ public:
 
     inline void seed(integer_type value) { state_ = xorshift64_range_engine(value).seed(); }
 
-    inline void discard(unsigned long long times)
-    {
-        for (; times > 0; --times)
-            state_ = xorshift64(state_);
-    }
+    inline void discard(unsigned long long times) { state_ = xorshift64_jump(state_, times); }
 
     std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy);
 
+    // The output is identical to the sequential one: each block starts from the lane states jumped ahead to its
+    // position, so it does not depend on the number of threads.
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy);
+
     std::span<integer_type> operator()(const std::span<integer_type> integers,
                                        cppx::EndiannessPolicy auto endianness_policy)
     {
@@ -161,36 +241,60 @@ public:
         return integers;
     }
 
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+    static constexpr std::size_t parallel_block_size = (1024 * 1024) / (SeedCount * sizeof(integer_type)) * SeedCount;
+
+private:
+    void init_states_(integer_type (&states)[SeedCount]) const;
+    static void fill_(integer_type (&states)[SeedCount], std::span<integer_type> uints,
+                      cppx::EndiannessPolicy auto endianness_policy);
+    void fill_remaining_bytes_(std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy);
+
 private:
     integer_type state_;
 };
 
 template <std::size_t SeedCount, int RotationFactor>
     requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
-std::span<std::byte>
-xorshift64_range_engine<SeedCount, RotationFactor>::operator()(const std::span<std::byte> bytes,
-                                                               cppx::EndiannessPolicy auto endianness_policy)
+void xorshift64_range_engine<SeedCount, RotationFactor>::init_states_(integer_type (&states)[SeedCount]) const
 {
     const std::size_t seed_count = SeedCount;
-    integer_type states[seed_count];
     std::size_t i = 0;
     for (std::size_t end_i = seed_count / 2; i < end_i; ++i)
         states[i] = std::rotl(state_, i * RotationFactor);
     for (std::size_t j = 0; i < seed_count; ++i, ++j)
         states[i] = std::rotr(~state_, j * RotationFactor);
+}
 
-    i = 0;
-    const std::span uints = core::as_writable_span<integer_type>(bytes);
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+void xorshift64_range_engine<SeedCount, RotationFactor>::fill_(integer_type (&states)[SeedCount],
+                                                              std::span<integer_type> uints,
+                                                              cppx::EndiannessPolicy auto endianness_policy)
+{
+    const std::size_t seed_count = SeedCount;
+    std::size_t i = private_::xorshift_lanes_fill_(states, uints, endianness_policy);
     auto xorshift_fn = [&](integer_type& val)
     {
         uint64_t& state = states[i++ % seed_count];
         state = xorshift64(state);
         val = core::htow_when(state, endianness_policy);
     };
-    std::for_each(uints.begin(), uints.end(), xorshift_fn);
-
-    state_ = xorshift64(states[0]);
+    std::for_each(uints.begin() + i, uints.end(), xorshift_fn);
+}
 
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+void xorshift64_range_engine<SeedCount, RotationFactor>::fill_remaining_bytes_(
+    std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+{
     if (std::size_t remaining_bytes = bytes.size() & (sizeof(integer_type) - 1); remaining_bytes > 0)
     {
         const std::span output_bytes = bytes.last(remaining_bytes);
@@ -199,7 +303,56 @@ xorshift64_range_engine<SeedCount, RotationFactor>::operator()(const std::span<s
         std::ranges::copy(input_bytes, output_bytes.begin());
         state_ = xorshift64(state_);
     }
+}
 
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+std::span<std::byte>
+xorshift64_range_engine<SeedCount, RotationFactor>::operator()(const std::span<std::byte> bytes,
+                                                              cppx::EndiannessPolicy auto endianness_policy)
+{
+    integer_type states[SeedCount];
+    init_states_(states);
+    fill_(states, core::as_writable_span<integer_type>(bytes), endianness_policy);
+    state_ = xorshift64(states[0]);
+    fill_remaining_bytes_(bytes, endianness_policy);
+    return bytes;
+}
+
+template <std::size_t SeedCount, int RotationFactor>
+    requires(SeedCount > 0 && (SeedCount & 1) == 0 && RotationFactor != 0)
+std::span<std::byte>
+xorshift64_range_engine<SeedCount, RotationFactor>::operator()(const std::span<std::byte> bytes,
+                                                              cppx::EndiannessPolicy auto endianness_policy,
+                                                              cppx::ExecutionPolicy auto execution_policy)
+{
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>)
+        return (*this)(bytes, endianness_policy);
+
+    const std::span uints = core::as_writable_span<integer_type>(bytes);
+    const std::size_t nb_blocks = (uints.size() + parallel_block_size - 1) / parallel_block_size;
+    if (nb_blocks <= 1)
+        return (*this)(bytes, endianness_policy);
+
+    integer_type init_states[SeedCount];
+    init_states_(init_states);
+    std::vector<std::size_t> block_indexes(nb_blocks);
+    std::iota(block_indexes.begin(), block_indexes.end(), 0);
+    std::for_each(execution_policy, block_indexes.cbegin(), block_indexes.cend(),
+                  [&](std::size_t block_index)
+                  {
+                      const unsigned long long nb_rounds = block_index * (parallel_block_size / SeedCount);
+                      integer_type states[SeedCount];
+                      for (std::size_t i = 0; i < SeedCount; ++i)
+                          states[i] = xorshift64_jump(init_states[i], nb_rounds);
+                      const std::size_t offset = block_index * parallel_block_size;
+                      fill_(states, uints.subspan(offset, std::min(parallel_block_size, uints.size() - offset)),
+                            endianness_policy);
+                  });
+
+    // The first lane is advanced once per started round.
+    state_ = xorshift64(xorshift64_jump(init_states[0], (uints.size() + SeedCount - 1) / SeedCount));
+    fill_remaining_bytes_(bytes, endianness_policy);
     return bytes;
 }
 
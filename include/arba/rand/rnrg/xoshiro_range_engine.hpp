@@ -0,0 +1,229 @@
+#pragma once
+
+#include <arba/rand/simd/xoshiro_lanes.hpp>
+#include <arba/rand/xoshiro.hpp>
+#include <arba/rand/xoshiro_jump.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+struct xoshiro256ss_generator_
+{
+    using state_type = xoshiro256_state;
+
+    static constexpr uint64_t next(state_type& state) { return xoshiro256ss(state); }
+    static constexpr state_type seed_state(uint64_t seed) { return xoshiro256_seed_state(seed); }
+    static constexpr state_type jump(const state_type& state) { return xoshiro256_jump(state); }
+    static constexpr state_type jump(const state_type& state, unsigned long long times)
+    {
+        return xoshiro256_jump(state, times);
+    }
+    static constexpr state_type long_jump(const state_type& state) { return xoshiro256_long_jump(state); }
+};
+
+struct xoroshiro128plus_generator_
+{
+    using state_type = xoroshiro128_state;
+
+    static constexpr uint64_t next(state_type& state) { return xoroshiro128plus(state); }
+    static constexpr state_type seed_state(uint64_t seed) { return xoroshiro128_seed_state(seed); }
+    static constexpr state_type jump(const state_type& state) { return xoroshiro128_jump(state); }
+    static constexpr state_type jump(const state_type& state, unsigned long long times)
+    {
+        return xoroshiro128_jump(state, times);
+    }
+    static constexpr state_type long_jump(const state_type& state) { return xoroshiro128_long_jump(state); }
+};
+
+// Range engine interleaving LaneCount generators of the xoshiro family (value i comes from lane i % LaneCount): the
+// lanes are independent, so their steps overlap in the pipeline. Lane k starts k long jumps after the state seeded
+// with splitmix64, and the lanes keep running from one call to the next.
+// A request is cut into blocks of parallel_block_size values; block b runs the lanes jumped b times, so that the
+// blocks can be filled in any order: the output does not depend on the execution policy. After a request, the lanes
+// continue from the end of its last block.
+template <class GeneratorT, std::size_t LaneCount>
+    requires(LaneCount > 0)
+class xoshiro_range_engine_
+{
+public:
+    using integer_type = uint64_t;
+    using state_type = typename GeneratorT::state_type;
+    static constexpr std::size_t number_of_lanes = LaneCount;
+
+    inline explicit xoshiro_range_engine_(integer_type seed_value) { seed(seed_value); }
+
+    xoshiro_range_engine_() : xoshiro_range_engine_(std::random_device{}()) {}
+
+    // Last seed value, the state of the lanes not fitting in an integer_type.
+    [[nodiscard]] inline integer_type seed() const { return seed_; }
+
+    void seed(integer_type value)
+    {
+        seed_ = value;
+        lanes_[0] = GeneratorT::seed_state(value);
+        for (std::size_t i = 1; i < LaneCount; ++i)
+            lanes_[i] = GeneratorT::long_jump(lanes_[i - 1]);
+    }
+
+    // Advances every lane times steps, in O(log(times)).
+    void discard(unsigned long long times)
+    {
+        for (state_type& lane : lanes_)
+            lane = GeneratorT::jump(lane, times);
+    }
+
+    // Moves the lanes LaneCount long jumps ahead, past the lanes of the engine before the jump: copies of an engine
+    // jumped 0, 1, 2... times generate non-overlapping sequences, one per thread.
+    void jump()
+    {
+        for (state_type& lane : lanes_)
+            for (std::size_t i = 0; i < LaneCount; ++i)
+                lane = GeneratorT::long_jump(lane);
+    }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        return (*this)(bytes, endianness_policy, std::execution::seq);
+    }
+
+    std::span<std::byte> operator()(const std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy,
+                                    cppx::ExecutionPolicy auto execution_policy);
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy);
+        return integers;
+    }
+
+    std::span<integer_type> operator()(const std::span<integer_type> integers,
+                                       cppx::EndiannessPolicy auto endianness_policy,
+                                       cppx::ExecutionPolicy auto execution_policy)
+    {
+        (*this)(std::as_writable_bytes(integers), endianness_policy, execution_policy);
+        return integers;
+    }
+
+    static constexpr std::size_t parallel_block_size =
+        (1024 * 1024) / (LaneCount * sizeof(integer_type)) * LaneCount;
+
+private:
+    using lanes_type = std::array<state_type, LaneCount>;
+
+    static lanes_type jump_lanes_(lanes_type lanes)
+    {
+        for (state_type& lane : lanes)
+            lane = GeneratorT::jump(lane);
+        return lanes;
+    }
+
+    static void fill_(lanes_type& lanes, std::span<integer_type> uints, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        std::size_t i = xoshiro_lanes_fill_(lanes, uints, endianness_policy);
+        lanes_type states = lanes;
+        // Round unrolled over the lanes, for their states to stay in registers.
+        const auto round_fn = [&]<std::size_t... Lanes>(std::index_sequence<Lanes...>)
+        {
+            ((uints[i + Lanes] = core::htow_when(GeneratorT::next(states[Lanes]), endianness_policy)), ...);
+        };
+        for (const std::size_t end_i = uints.size() / LaneCount * LaneCount; i < end_i; i += LaneCount)
+            round_fn(std::make_index_sequence<LaneCount>());
+        for (std::size_t lane = 0; i < uints.size(); ++i, ++lane)
+            uints[i] = core::htow_when(GeneratorT::next(states[lane]), endianness_policy);
+        lanes = states;
+    }
+
+    void fill_remaining_bytes_(std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+    {
+        if (std::size_t remaining_bytes = bytes.size() & (sizeof(integer_type) - 1); remaining_bytes > 0)
+        {
+            const std::span output_bytes = bytes.last(remaining_bytes);
+            integer_type value = core::htow_when(GeneratorT::next(lanes_[0]), endianness_policy);
+            const std::span input_bytes = core::as_writable_bytes(value).first(remaining_bytes);
+            std::ranges::copy(input_bytes, output_bytes.begin());
+        }
+    }
+
+private:
+    integer_type seed_;
+    lanes_type lanes_;
+};
+
+template <class GeneratorT, std::size_t LaneCount>
+    requires(LaneCount > 0)
+std::span<std::byte>
+xoshiro_range_engine_<GeneratorT, LaneCount>::operator()(const std::span<std::byte> bytes,
+                                                        cppx::EndiannessPolicy auto endianness_policy,
+                                                        cppx::ExecutionPolicy auto execution_policy)
+{
+    const std::span uints = core::as_writable_span<integer_type>(bytes);
+    const std::size_t nb_blocks = (uints.size() + parallel_block_size - 1) / parallel_block_size;
+    if (nb_blocks <= 1
+        || std::is_same_v<std::remove_cvref_t<decltype(execution_policy)>, std::execution::sequenced_policy>)
+    {
+        lanes_type block_lanes = lanes_;
+        for (std::size_t offset = 0;;)
+        {
+            lanes_ = block_lanes;
+            fill_(lanes_, uints.subspan(offset, std::min(parallel_block_size, uints.size() - offset)),
+                  endianness_policy);
+            offset += parallel_block_size;
+            if (offset >= uints.size())
+                break;
+            block_lanes = jump_lanes_(block_lanes);
+        }
+    }
+    else
+    {
+        std::vector<lanes_type> blocks_lanes(nb_blocks);
+        blocks_lanes[0] = lanes_;
+        for (std::size_t i = 1; i < nb_blocks; ++i)
+            blocks_lanes[i] = jump_lanes_(blocks_lanes[i - 1]);
+        std::vector<std::size_t> block_indexes(nb_blocks);
+        std::iota(block_indexes.begin(), block_indexes.end(), 0);
+        std::for_each(execution_policy, block_indexes.cbegin(), block_indexes.cend(),
+                      [&](std::size_t block_index)
+                      {
+                          const std::size_t offset = block_index * parallel_block_size;
+                          fill_(blocks_lanes[block_index],
+                                uints.subspan(offset, std::min(parallel_block_size, uints.size() - offset)),
+                                endianness_policy);
+                      });
+        lanes_ = blocks_lanes.back();
+    }
+    fill_remaining_bytes_(bytes, endianness_policy);
+    return bytes;
+}
+
+} // namespace private_
+
+// Range engine of LaneCount interleaved xoshiro256** generators.
+template <std::size_t LaneCount = 4>
+using xoshiro256ss_range_engine = private_::xoshiro_range_engine_<private_::xoshiro256ss_generator_, LaneCount>;
+
+// Range engine of LaneCount interleaved xoroshiro128+ generators. The lanes are 2^96 steps apart and the blocks of a
+// request 2^64 steps apart: the lanes do not overlap before 2^32 blocks.
+template <std::size_t LaneCount = 4>
+using xoroshiro128plus_range_engine =
+    private_::xoshiro_range_engine_<private_::xoroshiro128plus_generator_, LaneCount>;
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <arba/rand/chacha.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#ifdef ARBA_RAND_X86_SIMD
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+#ifdef ARBA_RAND_X86_SIMD
+
+// Each vector holds one word of the states of consecutive blocks (8 with AVX2, 16 with AVX-512): the quarter rounds
+// run on whole vectors, then the words are transposed so that the blocks are stored one after the other.
+
+__attribute__((target("avx2"))) inline void chacha_quarter_round_avx2_(__m256i& a, __m256i& b, __m256i& c, __m256i& d)
+{
+    const __m256i rotl_16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1, 6, 7, 4,
+                                             5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m256i rotl_8 = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14, 3, 0, 1, 2, 7, 4, 5,
+                                            6, 11, 8, 9, 10, 15, 12, 13, 14);
+    a = _mm256_add_epi32(a, b);
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotl_16);
+    c = _mm256_add_epi32(c, d);
+    b = _mm256_xor_si256(b, c);
+    b = _mm256_or_si256(_mm256_slli_epi32(b, 12), _mm256_srli_epi32(b, 20));
+    a = _mm256_add_epi32(a, b);
+    d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotl_8);
+    c = _mm256_add_epi32(c, d);
+    b = _mm256_xor_si256(b, c);
+    b = _mm256_or_si256(_mm256_slli_epi32(b, 7), _mm256_srli_epi32(b, 25));
+}
+
+// Transposes 8 vectors of 8 words: word i of vector j becomes word j of vector i.
+__attribute__((target("avx2"))) inline void chacha_transpose_8x8_avx2_(__m256i (&m)[8])
+{
+    __m256i t[8], u[8];
+    for (std::size_t i = 0; i < 8; i += 2)
+    {
+        t[i] = _mm256_unpacklo_epi32(m[i], m[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(m[i], m[i + 1]);
+    }
+    for (std::size_t i = 0; i < 8; i += 4)
+    {
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        m[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+        m[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+    }
+}
+
+template <unsigned Rounds, bool ByteSwap>
+__attribute__((target("avx2"))) void chacha_blocks_avx2_(const chacha_key& key, uint64_t nonce, uint64_t block_index,
+                                                         uint32_t* output, std::size_t nb_batches)
+{
+    const __m256i sign_bit = _mm256_set1_epi32(int(0x80000000u));
+    const __m256i byte_swap_mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0,
+                                                    7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i input[16];
+    for (std::size_t i = 0; i < 4; ++i)
+        input[i] = _mm256_set1_epi32(int(chacha_constants_[i]));
+    for (std::size_t i = 0; i < 8; ++i)
+        input[4 + i] = _mm256_set1_epi32(int(key[i]));
+    input[14] = _mm256_set1_epi32(int(uint32_t(nonce)));
+    input[15] = _mm256_set1_epi32(int(uint32_t(nonce >> 32)));
+    for (; nb_batches > 0; --nb_batches, block_index += 8, output += 128)
+    {
+        const __m256i low_index = _mm256_set1_epi32(int(uint32_t(block_index)));
+        input[12] = _mm256_add_epi32(low_index, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        // The high half of the counter is incremented (minus -1) where the low half wraps around.
+        const __m256i carry =
+            _mm256_cmpgt_epi32(_mm256_xor_si256(low_index, sign_bit), _mm256_xor_si256(input[12], sign_bit));
+        input[13] = _mm256_sub_epi32(_mm256_set1_epi32(int(uint32_t(block_index >> 32))), carry);
+
+        __m256i x[16];
+        for (std::size_t i = 0; i < 16; ++i)
+            x[i] = input[i];
+        for (unsigned round = 0; round < Rounds; round += 2)
+        {
+            chacha_quarter_round_avx2_(x[0], x[4], x[8], x[12]);
+            chacha_quarter_round_avx2_(x[1], x[5], x[9], x[13]);
+            chacha_quarter_round_avx2_(x[2], x[6], x[10], x[14]);
+            chacha_quarter_round_avx2_(x[3], x[7], x[11], x[15]);
+            chacha_quarter_round_avx2_(x[0], x[5], x[10], x[15]);
+            chacha_quarter_round_avx2_(x[1], x[6], x[11], x[12]);
+            chacha_quarter_round_avx2_(x[2], x[7], x[8], x[13]);
+            chacha_quarter_round_avx2_(x[3], x[4], x[9], x[14]);
+        }
+        __m256i low_words[8], high_words[8];
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            low_words[i] = _mm256_add_epi32(x[i], input[i]);
+            high_words[i] = _mm256_add_epi32(x[8 + i], input[8 + i]);
+        }
+        chacha_transpose_8x8_avx2_(low_words);
+        chacha_transpose_8x8_avx2_(high_words);
+        for (std::size_t block = 0; block < 8; ++block)
+        {
+            if constexpr (ByteSwap)
+            {
+                low_words[block] = _mm256_shuffle_epi8(low_words[block], byte_swap_mask);
+                high_words[block] = _mm256_shuffle_epi8(high_words[block], byte_swap_mask);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + block * 16), low_words[block]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + block * 16 + 8), high_words[block]);
+        }
+    }
+}
+
+__attribute__((target("avx512f,avx512bw"))) inline void chacha_quarter_round_avx512_(__m512i& a, __m512i& b,
+                                                                                     __m512i& c, __m512i& d)
+{
+    a = _mm512_add_epi32(a, b);
+    d = _mm512_rol_epi32(_mm512_xor_si512(d, a), 16);
+    c = _mm512_add_epi32(c, d);
+    b = _mm512_rol_epi32(_mm512_xor_si512(b, c), 12);
+    a = _mm512_add_epi32(a, b);
+    d = _mm512_rol_epi32(_mm512_xor_si512(d, a), 8);
+    c = _mm512_add_epi32(c, d);
+    b = _mm512_rol_epi32(_mm512_xor_si512(b, c), 7);
+}
+
+template <unsigned Rounds, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void chacha_blocks_avx512_(const chacha_key& key, uint64_t nonce,
+                                                                       uint64_t block_index, uint32_t* output,
+                                                                       std::size_t nb_batches)
+{
+    const __m512i byte_swap_mask =
+        _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    __m512i input[16];
+    for (std::size_t i = 0; i < 4; ++i)
+        input[i] = _mm512_set1_epi32(int(chacha_constants_[i]));
+    for (std::size_t i = 0; i < 8; ++i)
+        input[4 + i] = _mm512_set1_epi32(int(key[i]));
+    input[14] = _mm512_set1_epi32(int(uint32_t(nonce)));
+    input[15] = _mm512_set1_epi32(int(uint32_t(nonce >> 32)));
+    for (; nb_batches > 0; --nb_batches, block_index += 16, output += 256)
+    {
+        const __m512i low_index = _mm512_set1_epi32(int(uint32_t(block_index)));
+        input[12] = _mm512_add_epi32(low_index,
+                                     _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        const __m512i high_index = _mm512_set1_epi32(int(uint32_t(block_index >> 32)));
+        input[13] = _mm512_mask_add_epi32(high_index, _mm512_cmplt_epu32_mask(input[12], low_index), high_index,
+                                          _mm512_set1_epi32(1));
+
+        __m512i x[16];
+        for (std::size_t i = 0; i < 16; ++i)
+            x[i] = input[i];
+        for (unsigned round = 0; round < Rounds; round += 2)
+        {
+            chacha_quarter_round_avx512_(x[0], x[4], x[8], x[12]);
+            chacha_quarter_round_avx512_(x[1], x[5], x[9], x[13]);
+            chacha_quarter_round_avx512_(x[2], x[6], x[10], x[14]);
+            chacha_quarter_round_avx512_(x[3], x[7], x[11], x[15]);
+            chacha_quarter_round_avx512_(x[0], x[5], x[10], x[15]);
+            chacha_quarter_round_avx512_(x[1], x[6], x[11], x[12]);
+            chacha_quarter_round_avx512_(x[2], x[7], x[8], x[13]);
+            chacha_quarter_round_avx512_(x[3], x[4], x[9], x[14]);
+        }
+        for (std::size_t i = 0; i < 16; ++i)
+            x[i] = _mm512_add_epi32(x[i], input[i]);
+
+        // Words 4g to 4g + 3 of block 4l + k are the 128-bit lane l of u[g][k].
+        __m512i u[4][4];
+        for (std::size_t g = 0; g < 4; ++g)
+        {
+            const __m512i t0 = _mm512_unpacklo_epi32(x[4 * g], x[4 * g + 1]);
+            const __m512i t1 = _mm512_unpackhi_epi32(x[4 * g], x[4 * g + 1]);
+            const __m512i t2 = _mm512_unpacklo_epi32(x[4 * g + 2], x[4 * g + 3]);
+            const __m512i t3 = _mm512_unpackhi_epi32(x[4 * g + 2], x[4 * g + 3]);
+            u[g][0] = _mm512_unpacklo_epi64(t0, t2);
+            u[g][1] = _mm512_unpackhi_epi64(t0, t2);
+            u[g][2] = _mm512_unpacklo_epi64(t1, t3);
+            u[g][3] = _mm512_unpackhi_epi64(t1, t3);
+        }
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            const __m512i v0 = _mm512_shuffle_i32x4(u[0][k], u[1][k], 0x44); // lanes 0 | 1 of u[0], then of u[1]
+            const __m512i v1 = _mm512_shuffle_i32x4(u[2][k], u[3][k], 0x44);
+            const __m512i v2 = _mm512_shuffle_i32x4(u[0][k], u[1][k], 0xEE); // lanes 2 | 3 of u[0], then of u[1]
+            const __m512i v3 = _mm512_shuffle_i32x4(u[2][k], u[3][k], 0xEE);
+            __m512i blocks[] = { _mm512_shuffle_i32x4(v0, v1, 0x88), _mm512_shuffle_i32x4(v0, v1, 0xDD),
+                                 _mm512_shuffle_i32x4(v2, v3, 0x88), _mm512_shuffle_i32x4(v2, v3, 0xDD) };
+            for (std::size_t l = 0; l < std::size(blocks); ++l)
+            {
+                if constexpr (ByteSwap)
+                    blocks[l] = _mm512_shuffle_epi8(blocks[l], byte_swap_mask);
+                _mm512_storeu_si512(output + (4 * l + k) * 16, blocks[l]);
+            }
+        }
+    }
+}
+
+template <unsigned Rounds, bool ByteSwap>
+std::size_t chacha_blocks_kernel_(const chacha_key& key, uint64_t nonce, uint64_t block_index,
+                                  std::span<uint32_t> words, simd_isa isa)
+{
+    if (isa >= simd_isa::avx512)
+    {
+        const std::size_t nb_batches = words.size() / 256;
+        chacha_blocks_avx512_<Rounds, ByteSwap>(key, nonce, block_index, words.data(), nb_batches);
+        return nb_batches * 256;
+    }
+    const std::size_t nb_batches = words.size() / 128;
+    chacha_blocks_avx2_<Rounds, ByteSwap>(key, nonce, block_index, words.data(), nb_batches);
+    return nb_batches * 128;
+}
+
+#endif
+
+// Writes the ChaCha blocks of the counters block_index, block_index + 1... in words (whole blocks) with the widest
+// available SIMD kernel. Returns the number of words written (0 if no kernel applies); the caller finishes the
+// remaining blocks with the scalar path.
+template <unsigned Rounds>
+std::size_t chacha_blocks_simd_([[maybe_unused]] const chacha_key& key, [[maybe_unused]] uint64_t nonce,
+                                [[maybe_unused]] uint64_t block_index, [[maybe_unused]] std::span<uint32_t> words,
+                                [[maybe_unused]] cppx::EndiannessPolicy auto endianness_policy)
+{
+#ifdef ARBA_RAND_X86_SIMD
+    const simd_isa isa = active_simd_isa();
+    if (isa == simd_isa::scalar)
+        return 0;
+    return core::htow_when(uint32_t(1), endianness_policy) != uint32_t(1)
+               ? chacha_blocks_kernel_<Rounds, true>(key, nonce, block_index, words, isa)
+               : chacha_blocks_kernel_<Rounds, false>(key, nonce, block_index, words, isa);
+#else
+    return 0;
+#endif
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
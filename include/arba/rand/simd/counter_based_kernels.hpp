@@ -0,0 +1,380 @@
+#pragma once
+
+#include <arba/rand/philox.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
+#include <arba/rand/threefry.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#ifdef ARBA_RAND_X86_SIMD
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+#ifdef ARBA_RAND_X86_SIMD
+
+// Each vector holds one word of the blocks of consecutive counters: a batch computes one block per vector element,
+// then transposes the words so that the blocks are stored one after the other.
+
+template <unsigned Rounds>
+constexpr std::array<philox4x32_key, Rounds> philox4x32_round_keys_(philox4x32_key key)
+{
+    std::array<philox4x32_key, Rounds> round_keys;
+    for (unsigned round = 0; round < Rounds; ++round, key[0] += 0x9E3779B9u, key[1] += 0xBB67AE85u)
+        round_keys[round] = key;
+    return round_keys;
+}
+
+// The Philox4x32 kernels compute two vectors of blocks at a time, for the products of one to overlap with the
+// products of the other.
+
+template <unsigned Rounds, bool ByteSwap>
+__attribute__((target("avx2"))) void philox4x32_blocks_avx2_(uint64_t block_index, const philox4x32_key& key,
+                                                             uint32_t* output, std::size_t nb_batches)
+{
+    const std::array round_keys = philox4x32_round_keys_<Rounds>(key);
+    const __m256i multiplier_0 = _mm256_set1_epi32(int(0xD2511F53u));
+    const __m256i multiplier_1 = _mm256_set1_epi32(int(0xCD9E8D57u));
+    const __m256i sign_bit = _mm256_set1_epi32(int(0x80000000u));
+    const __m256i byte_swap_mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0,
+                                                    7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    for (; nb_batches > 0; --nb_batches, block_index += 16, output += 64)
+    {
+        const __m256i low_index = _mm256_set1_epi32(int(uint32_t(block_index)));
+        const __m256i high_index = _mm256_set1_epi32(int(uint32_t(block_index >> 32)));
+        __m256i c0[2] = { _mm256_add_epi32(low_index, _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)),
+                          _mm256_add_epi32(low_index, _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15)) };
+        __m256i c1[2], c2[2], c3[2];
+        for (std::size_t v = 0; v < 2; ++v)
+        {
+            // The high half of the index is incremented (minus -1) where the low half wraps around.
+            const __m256i carry =
+                _mm256_cmpgt_epi32(_mm256_xor_si256(low_index, sign_bit), _mm256_xor_si256(c0[v], sign_bit));
+            c1[v] = _mm256_sub_epi32(high_index, carry);
+            c2[v] = _mm256_setzero_si256();
+            c3[v] = _mm256_setzero_si256();
+        }
+        for (const philox4x32_key& round_key : round_keys)
+        {
+            const __m256i key_0 = _mm256_set1_epi32(int(round_key[0]));
+            const __m256i key_1 = _mm256_set1_epi32(int(round_key[1]));
+            for (std::size_t v = 0; v < 2; ++v)
+            {
+                // 32x32->64 products of the even elements, then of the odd ones, recombined in low and high halves.
+                const __m256i even_0 = _mm256_mul_epu32(c0[v], multiplier_0);
+                const __m256i odd_0 = _mm256_mul_epu32(_mm256_srli_epi64(c0[v], 32), multiplier_0);
+                const __m256i even_1 = _mm256_mul_epu32(c2[v], multiplier_1);
+                const __m256i odd_1 = _mm256_mul_epu32(_mm256_srli_epi64(c2[v], 32), multiplier_1);
+                const __m256i low_0 = _mm256_blend_epi32(even_0, _mm256_slli_epi64(odd_0, 32), 0xAA);
+                const __m256i high_0 = _mm256_blend_epi32(_mm256_srli_epi64(even_0, 32), odd_0, 0xAA);
+                const __m256i low_1 = _mm256_blend_epi32(even_1, _mm256_slli_epi64(odd_1, 32), 0xAA);
+                const __m256i high_1 = _mm256_blend_epi32(_mm256_srli_epi64(even_1, 32), odd_1, 0xAA);
+                c0[v] = _mm256_xor_si256(_mm256_xor_si256(high_1, c1[v]), key_0);
+                c1[v] = low_1;
+                c2[v] = _mm256_xor_si256(_mm256_xor_si256(high_0, c3[v]), key_1);
+                c3[v] = low_0;
+            }
+        }
+        for (std::size_t v = 0; v < 2; ++v)
+        {
+            const __m256i t0 = _mm256_unpacklo_epi32(c0[v], c1[v]);
+            const __m256i t1 = _mm256_unpackhi_epi32(c0[v], c1[v]);
+            const __m256i t2 = _mm256_unpacklo_epi32(c2[v], c3[v]);
+            const __m256i t3 = _mm256_unpackhi_epi32(c2[v], c3[v]);
+            const __m256i u0 = _mm256_unpacklo_epi64(t0, t2); // blocks 0 | 4
+            const __m256i u1 = _mm256_unpackhi_epi64(t0, t2); // blocks 1 | 5
+            const __m256i u2 = _mm256_unpacklo_epi64(t1, t3); // blocks 2 | 6
+            const __m256i u3 = _mm256_unpackhi_epi64(t1, t3); // blocks 3 | 7
+            __m256i blocks[] = { _mm256_permute2x128_si256(u0, u1, 0x20), _mm256_permute2x128_si256(u2, u3, 0x20),
+                                 _mm256_permute2x128_si256(u0, u1, 0x31), _mm256_permute2x128_si256(u2, u3, 0x31) };
+            for (std::size_t w = 0; w < std::size(blocks); ++w)
+            {
+                if constexpr (ByteSwap)
+                    blocks[w] = _mm256_shuffle_epi8(blocks[w], byte_swap_mask);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + v * 32 + w * 8), blocks[w]);
+            }
+        }
+    }
+}
+
+template <unsigned Rounds, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void philox4x32_blocks_avx512_(uint64_t block_index,
+                                                                           const philox4x32_key& key,
+                                                                           uint32_t* output, std::size_t nb_batches)
+{
+    const std::array round_keys = philox4x32_round_keys_<Rounds>(key);
+    const __m512i multiplier_0 = _mm512_set1_epi32(int(0xD2511F53u));
+    const __m512i multiplier_1 = _mm512_set1_epi32(int(0xCD9E8D57u));
+    const __m512i byte_swap_mask =
+        _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    const __m512i indexes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    for (; nb_batches > 0; --nb_batches, block_index += 32, output += 128)
+    {
+        const __m512i low_index = _mm512_set1_epi32(int(uint32_t(block_index)));
+        const __m512i high_index = _mm512_set1_epi32(int(uint32_t(block_index >> 32)));
+        __m512i c0[2] = { _mm512_add_epi32(low_index, indexes),
+                          _mm512_add_epi32(low_index, _mm512_add_epi32(indexes, _mm512_set1_epi32(16))) };
+        __m512i c1[2], c2[2], c3[2];
+        for (std::size_t v = 0; v < 2; ++v)
+        {
+            c1[v] = _mm512_mask_add_epi32(high_index, _mm512_cmplt_epu32_mask(c0[v], low_index), high_index,
+                                          _mm512_set1_epi32(1));
+            c2[v] = _mm512_setzero_si512();
+            c3[v] = _mm512_setzero_si512();
+        }
+        for (const philox4x32_key& round_key : round_keys)
+        {
+            const __m512i key_0 = _mm512_set1_epi32(int(round_key[0]));
+            const __m512i key_1 = _mm512_set1_epi32(int(round_key[1]));
+            for (std::size_t v = 0; v < 2; ++v)
+            {
+                const __m512i even_0 = _mm512_mul_epu32(c0[v], multiplier_0);
+                const __m512i odd_0 = _mm512_mul_epu32(_mm512_srli_epi64(c0[v], 32), multiplier_0);
+                const __m512i even_1 = _mm512_mul_epu32(c2[v], multiplier_1);
+                const __m512i odd_1 = _mm512_mul_epu32(_mm512_srli_epi64(c2[v], 32), multiplier_1);
+                const __m512i low_0 = _mm512_mask_blend_epi32(0xAAAA, even_0, _mm512_slli_epi64(odd_0, 32));
+                const __m512i high_0 = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even_0, 32), odd_0);
+                const __m512i low_1 = _mm512_mask_blend_epi32(0xAAAA, even_1, _mm512_slli_epi64(odd_1, 32));
+                const __m512i high_1 = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even_1, 32), odd_1);
+                c0[v] = _mm512_ternarylogic_epi32(high_1, c1[v], key_0, 0x96); // a ^ b ^ c
+                c1[v] = low_1;
+                c2[v] = _mm512_ternarylogic_epi32(high_0, c3[v], key_1, 0x96);
+                c3[v] = low_0;
+            }
+        }
+        for (std::size_t v = 0; v < 2; ++v)
+        {
+            const __m512i t0 = _mm512_unpacklo_epi32(c0[v], c1[v]);
+            const __m512i t1 = _mm512_unpackhi_epi32(c0[v], c1[v]);
+            const __m512i t2 = _mm512_unpacklo_epi32(c2[v], c3[v]);
+            const __m512i t3 = _mm512_unpackhi_epi32(c2[v], c3[v]);
+            const __m512i u0 = _mm512_unpacklo_epi64(t0, t2);       // blocks 0 | 4 | 8 | 12
+            const __m512i u1 = _mm512_unpackhi_epi64(t0, t2);       // blocks 1 | 5 | 9 | 13
+            const __m512i u2 = _mm512_unpacklo_epi64(t1, t3);       // blocks 2 | 6 | 10 | 14
+            const __m512i u3 = _mm512_unpackhi_epi64(t1, t3);       // blocks 3 | 7 | 11 | 15
+            const __m512i w0 = _mm512_shuffle_i32x4(u0, u1, 0x44); // blocks 0 | 4 | 1 | 5
+            const __m512i w1 = _mm512_shuffle_i32x4(u2, u3, 0x44); // blocks 2 | 6 | 3 | 7
+            const __m512i w2 = _mm512_shuffle_i32x4(u0, u1, 0xEE); // blocks 8 | 12 | 9 | 13
+            const __m512i w3 = _mm512_shuffle_i32x4(u2, u3, 0xEE); // blocks 10 | 14 | 11 | 15
+            __m512i blocks[] = { _mm512_shuffle_i32x4(w0, w1, 0x88), _mm512_shuffle_i32x4(w0, w1, 0xDD),
+                                 _mm512_shuffle_i32x4(w2, w3, 0x88), _mm512_shuffle_i32x4(w2, w3, 0xDD) };
+            for (std::size_t w = 0; w < std::size(blocks); ++w)
+            {
+                if constexpr (ByteSwap)
+                    blocks[w] = _mm512_shuffle_epi8(blocks[w], byte_swap_mask);
+                _mm512_storeu_si512(output + v * 64 + w * 16, blocks[w]);
+            }
+        }
+    }
+}
+
+inline constexpr std::array<int, 8> threefry2x64_rotations_ = { 16, 42, 12, 31, 16, 32, 24, 21 };
+
+// The Threefry2x64 kernels compute two vectors of blocks at a time, for the rounds of one to overlap with the rounds of
+// the other, and unroll the rounds, for the rotations to be immediate.
+
+template <unsigned Round>
+__attribute__((target("avx2"))) inline void threefry2x64_round_avx2_(__m256i (&x0)[2], __m256i (&x1)[2],
+                                                                     const __m256i (&key_schedule)[3])
+{
+    constexpr int rotation = threefry2x64_rotations_[Round % 8];
+    for (std::size_t v = 0; v < 2; ++v)
+    {
+        x0[v] = _mm256_add_epi64(x0[v], x1[v]);
+        x1[v] = _mm256_or_si256(_mm256_slli_epi64(x1[v], rotation), _mm256_srli_epi64(x1[v], 64 - rotation));
+        x1[v] = _mm256_xor_si256(x1[v], x0[v]);
+        if constexpr (Round % 4 == 3)
+        {
+            constexpr unsigned injection = (Round + 1) / 4;
+            x0[v] = _mm256_add_epi64(x0[v], key_schedule[injection % 3]);
+            x1[v] = _mm256_add_epi64(_mm256_add_epi64(x1[v], key_schedule[(injection + 1) % 3]),
+                                     _mm256_set1_epi64x(injection));
+        }
+    }
+}
+
+template <unsigned... RoundIndexes>
+__attribute__((target("avx2"))) inline void threefry2x64_rounds_avx2_(__m256i (&x0)[2], __m256i (&x1)[2],
+                                                                      const __m256i (&key_schedule)[3],
+                                                                      std::integer_sequence<unsigned, RoundIndexes...>)
+{
+    (threefry2x64_round_avx2_<RoundIndexes>(x0, x1, key_schedule), ...);
+}
+
+template <unsigned Rounds, bool ByteSwap>
+__attribute__((target("avx2"))) void threefry2x64_blocks_avx2_(uint64_t block_index, const threefry2x64_key& key,
+                                                               uint64_t* output, std::size_t nb_batches)
+{
+    const __m256i key_schedule[3] = { _mm256_set1_epi64x(int64_t(key[0])), _mm256_set1_epi64x(int64_t(key[1])),
+                                      _mm256_set1_epi64x(int64_t(0x1BD11BDAA9FC1A22ull ^ key[0] ^ key[1])) };
+    const __m256i byte_swap_mask =
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12,
+                         11, 10, 9, 8);
+    for (; nb_batches > 0; --nb_batches, block_index += 8, output += 16)
+    {
+        const __m256i first_x0 = _mm256_add_epi64(_mm256_set1_epi64x(int64_t(block_index)), key_schedule[0]);
+        __m256i x0[2] = { _mm256_add_epi64(first_x0, _mm256_setr_epi64x(0, 1, 2, 3)),
+                          _mm256_add_epi64(first_x0, _mm256_setr_epi64x(4, 5, 6, 7)) };
+        __m256i x1[2] = { key_schedule[1], key_schedule[1] };
+        threefry2x64_rounds_avx2_(x0, x1, key_schedule, std::make_integer_sequence<unsigned, Rounds>());
+        for (std::size_t v = 0; v < 2; ++v)
+        {
+            const __m256i low = _mm256_unpacklo_epi64(x0[v], x1[v]);  // blocks 0 | 2
+            const __m256i high = _mm256_unpackhi_epi64(x0[v], x1[v]); // blocks 1 | 3
+            __m256i blocks[] = { _mm256_permute2x128_si256(low, high, 0x20),
+                                 _mm256_permute2x128_si256(low, high, 0x31) };
+            for (std::size_t w = 0; w < std::size(blocks); ++w)
+            {
+                if constexpr (ByteSwap)
+                    blocks[w] = _mm256_shuffle_epi8(blocks[w], byte_swap_mask);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + v * 8 + w * 4), blocks[w]);
+            }
+        }
+    }
+}
+
+template <unsigned Round>
+__attribute__((target("avx512f,avx512bw"))) inline void threefry2x64_round_avx512_(__m512i (&x0)[2], __m512i (&x1)[2],
+                                                                                   const __m512i (&key_schedule)[3])
+{
+    constexpr int rotation = threefry2x64_rotations_[Round % 8];
+    for (std::size_t v = 0; v < 2; ++v)
+    {
+        x0[v] = _mm512_add_epi64(x0[v], x1[v]);
+        x1[v] = _mm512_xor_si512(_mm512_rol_epi64(x1[v], rotation), x0[v]);
+        if constexpr (Round % 4 == 3)
+        {
+            constexpr unsigned injection = (Round + 1) / 4;
+            x0[v] = _mm512_add_epi64(x0[v], key_schedule[injection % 3]);
+            x1[v] = _mm512_add_epi64(_mm512_add_epi64(x1[v], key_schedule[(injection + 1) % 3]),
+                                     _mm512_set1_epi64(injection));
+        }
+    }
+}
+
+template <unsigned... RoundIndexes>
+__attribute__((target("avx512f,avx512bw"))) inline void
+threefry2x64_rounds_avx512_(__m512i (&x0)[2], __m512i (&x1)[2], const __m512i (&key_schedule)[3],
+                            std::integer_sequence<unsigned, RoundIndexes...>)
+{
+    (threefry2x64_round_avx512_<RoundIndexes>(x0, x1, key_schedule), ...);
+}
+
+template <unsigned Rounds, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void threefry2x64_blocks_avx512_(uint64_t block_index,
+                                                                             const threefry2x64_key& key,
+                                                                             uint64_t* output, std::size_t nb_batches)
+{
+    const __m512i key_schedule[3] = { _mm512_set1_epi64(int64_t(key[0])), _mm512_set1_epi64(int64_t(key[1])),
+                                      _mm512_set1_epi64(int64_t(0x1BD11BDAA9FC1A22ull ^ key[0] ^ key[1])) };
+    const __m512i byte_swap_mask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    const __m512i first_blocks_words = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    const __m512i last_blocks_words = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+    for (; nb_batches > 0; --nb_batches, block_index += 16, output += 32)
+    {
+        const __m512i first_x0 = _mm512_add_epi64(_mm512_set1_epi64(int64_t(block_index)), key_schedule[0]);
+        __m512i x0[2] = { _mm512_add_epi64(first_x0, _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7)),
+                          _mm512_add_epi64(first_x0, _mm512_setr_epi64(8, 9, 10, 11, 12, 13, 14, 15)) };
+        __m512i x1[2] = { key_schedule[1], key_schedule[1] };
+        threefry2x64_rounds_avx512_(x0, x1, key_schedule, std::make_integer_sequence<unsigned, Rounds>());
+        for (std::size_t v = 0; v < 2; ++v)
+        {
+            __m512i blocks[] = { _mm512_permutex2var_epi64(x0[v], first_blocks_words, x1[v]),
+                                 _mm512_permutex2var_epi64(x0[v], last_blocks_words, x1[v]) };
+            for (std::size_t w = 0; w < std::size(blocks); ++w)
+            {
+                if constexpr (ByteSwap)
+                    blocks[w] = _mm512_shuffle_epi8(blocks[w], byte_swap_mask);
+                _mm512_storeu_si512(output + v * 16 + w * 8, blocks[w]);
+            }
+        }
+    }
+}
+
+template <unsigned Rounds, bool ByteSwap>
+std::size_t philox4x32_blocks_kernel_(uint64_t block_index, const philox4x32_key& key, std::span<uint32_t> words,
+                                    simd_isa isa)
+{
+    if (isa >= simd_isa::avx512)
+    {
+        const std::size_t nb_batches = words.size() / 128;
+        philox4x32_blocks_avx512_<Rounds, ByteSwap>(block_index, key, words.data(), nb_batches);
+        return nb_batches * 128;
+    }
+    const std::size_t nb_batches = words.size() / 64;
+    philox4x32_blocks_avx2_<Rounds, ByteSwap>(block_index, key, words.data(), nb_batches);
+    return nb_batches * 64;
+}
+
+template <unsigned Rounds, bool ByteSwap>
+std::size_t threefry2x64_blocks_kernel_(uint64_t block_index, const threefry2x64_key& key, std::span<uint64_t> words,
+                                      simd_isa isa)
+{
+    if (isa >= simd_isa::avx512)
+    {
+        const std::size_t nb_batches = words.size() / 32;
+        threefry2x64_blocks_avx512_<Rounds, ByteSwap>(block_index, key, words.data(), nb_batches);
+        return nb_batches * 32;
+    }
+    const std::size_t nb_batches = words.size() / 16;
+    threefry2x64_blocks_avx2_<Rounds, ByteSwap>(block_index, key, words.data(), nb_batches);
+    return nb_batches * 16;
+}
+
+#endif
+
+// Writes the Philox4x32 blocks of the counters block_index, block_index + 1... in words (whole blocks) with the
+// widest available SIMD kernel. Returns the number of words written (0 if no kernel applies); the caller finishes
+// the remaining blocks with the scalar path.
+template <unsigned Rounds>
+std::size_t philox4x32_blocks_simd_([[maybe_unused]] uint64_t block_index, [[maybe_unused]] const philox4x32_key& key,
+                                    [[maybe_unused]] std::span<uint32_t> words,
+                                    [[maybe_unused]] cppx::EndiannessPolicy auto endianness_policy)
+{
+#ifdef ARBA_RAND_X86_SIMD
+    const simd_isa isa = active_simd_isa();
+    if (isa == simd_isa::scalar)
+        return 0;
+    return core::htow_when(uint32_t(1), endianness_policy) != uint32_t(1)
+               ? philox4x32_blocks_kernel_<Rounds, true>(block_index, key, words, isa)
+               : philox4x32_blocks_kernel_<Rounds, false>(block_index, key, words, isa);
+#else
+    return 0;
+#endif
+}
+
+// Threefry2x64 counterpart of philox4x32_blocks_simd_.
+template <unsigned Rounds>
+std::size_t threefry2x64_blocks_simd_([[maybe_unused]] uint64_t block_index,
+                                      [[maybe_unused]] const threefry2x64_key& key,
+                                      [[maybe_unused]] std::span<uint64_t> words,
+                                      [[maybe_unused]] cppx::EndiannessPolicy auto endianness_policy)
+{
+#ifdef ARBA_RAND_X86_SIMD
+    const simd_isa isa = active_simd_isa();
+    if (isa == simd_isa::scalar)
+        return 0;
+    return core::htow_when(uint64_t(1), endianness_policy) != uint64_t(1)
+               ? threefry2x64_blocks_kernel_<Rounds, true>(block_index, key, words, isa)
+               : threefry2x64_blocks_kernel_<Rounds, false>(block_index, key, words, isa);
+#else
+    return 0;
+#endif
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
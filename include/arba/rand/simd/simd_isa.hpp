@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#if !defined(ARBA_RAND_DISABLE_SIMD) && (defined(__x86_64__) || defined(__i386__))                                    \
+    && (defined(__GNUC__) || defined(__clang__))
+#define ARBA_RAND_X86_SIMD 1
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+
+// SIMD instruction sets for which the library provides kernels, ordered from the narrowest to the widest.
+enum class simd_isa : uint8_t
+{
+    scalar,
+    avx2,
+    avx512,
+};
+
+[[nodiscard]] constexpr std::string_view to_string(simd_isa isa)
+{
+    switch (isa)
+    {
+    case simd_isa::avx2:
+        return "avx2";
+    case simd_isa::avx512:
+        return "avx512";
+    default:
+        return "scalar";
+    }
+}
+
+// Widest instruction set supported by the running CPU (AVX-512 requires both the F and BW subsets).
+[[nodiscard]] inline simd_isa detected_simd_isa()
+{
+#ifdef ARBA_RAND_X86_SIMD
+    static const simd_isa isa = []
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            return simd_isa::avx512;
+        if (__builtin_cpu_supports("avx2"))
+            return simd_isa::avx2;
+        return simd_isa::scalar;
+    }();
+    return isa;
+#else
+    return simd_isa::scalar;
+#endif
+}
+
+namespace private_
+{
+
+inline std::atomic<simd_isa>& max_simd_isa_()
+{
+    static std::atomic<simd_isa> instance(simd_isa::avx512);
+    return instance;
+}
+
+} // namespace private_
+
+// Upper bound on the instruction set used by the kernels (mainly useful to test and benchmark each path).
+[[nodiscard]] inline simd_isa max_simd_isa()
+{
+    return private_::max_simd_isa_().load(std::memory_order_relaxed);
+}
+
+inline void set_max_simd_isa(simd_isa isa)
+{
+    private_::max_simd_isa_().store(isa, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline simd_isa active_simd_isa()
+{
+    return std::min(detected_simd_isa(), max_simd_isa());
+}
+
+} // namespace rand
+} // namespace arba
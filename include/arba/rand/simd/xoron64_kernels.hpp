@@ -0,0 +1,119 @@
+#pragma once
+
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+
+#include <cstdint>
+#include <span>
+
+#ifdef ARBA_RAND_X86_SIMD
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+#ifdef ARBA_RAND_X86_SIMD
+
+// Transforms of the expansion steps of xoron64_fill, on unaligned inputs:
+//  - alpha: rotl(mask ^ value, rot),
+//  - beta:  ~rotr(mask ^ value, rot),
+// the values being byte swapped on load and store when the words are stored in the other endianness.
+
+template <bool Beta, bool ByteSwap>
+__attribute__((target("avx2"))) std::size_t xoron64_transform_avx2_(const uint64_t* input, uint64_t* output,
+                                                                     std::size_t count, uint64_t xor_mask, int rot)
+{
+    const __m256i byte_swap_mask =
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12,
+                         11, 10, 9, 8);
+    const __m256i vxor_mask = _mm256_set1_epi64x(static_cast<long long>(xor_mask));
+    const __m256i all_ones = _mm256_set1_epi64x(-1);
+    const __m128i left_count = _mm_cvtsi32_si128(Beta ? 64 - rot : rot);
+    const __m128i right_count = _mm_cvtsi32_si128(Beta ? rot : 64 - rot);
+    const std::size_t simd_count = count & ~std::size_t(3);
+    for (std::size_t i = 0; i < simd_count; i += 4)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        if constexpr (ByteSwap)
+            x = _mm256_shuffle_epi8(x, byte_swap_mask);
+        x = _mm256_xor_si256(x, vxor_mask);
+        x = _mm256_or_si256(_mm256_sll_epi64(x, left_count), _mm256_srl_epi64(x, right_count));
+        if constexpr (Beta)
+            x = _mm256_xor_si256(x, all_ones);
+        if constexpr (ByteSwap)
+            x = _mm256_shuffle_epi8(x, byte_swap_mask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), x);
+    }
+    return simd_count;
+}
+
+template <bool Beta, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) std::size_t
+xoron64_transform_avx512_(const uint64_t* input, uint64_t* output, std::size_t count, uint64_t xor_mask, int rot)
+{
+    const __m512i byte_swap_mask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    const __m512i vxor_mask = _mm512_set1_epi64(static_cast<long long>(xor_mask));
+    const __m512i rot_count = _mm512_set1_epi64(rot);
+    const std::size_t simd_count = count & ~std::size_t(7);
+    for (std::size_t i = 0; i < simd_count; i += 8)
+    {
+        __m512i x = _mm512_loadu_si512(input + i);
+        if constexpr (ByteSwap)
+            x = _mm512_shuffle_epi8(x, byte_swap_mask);
+        x = _mm512_xor_si512(x, vxor_mask);
+        if constexpr (Beta)
+        {
+            x = _mm512_rorv_epi64(x, rot_count);
+            x = _mm512_ternarylogic_epi64(x, x, x, 0x55); // ~x
+        }
+        else
+            x = _mm512_rolv_epi64(x, rot_count);
+        if constexpr (ByteSwap)
+            x = _mm512_shuffle_epi8(x, byte_swap_mask);
+        _mm512_storeu_si512(output + i, x);
+    }
+    return simd_count;
+}
+
+#endif
+
+// Applies the alpha (or beta) transform to the first values of input with the widest available SIMD kernel.
+// Returns the number of values written (0 if no kernel applies); the caller finishes the remaining values with the
+// scalar path.
+template <bool Beta>
+std::size_t xoron64_transform_simd_([[maybe_unused]] std::span<const uint64_t> input,
+                                    [[maybe_unused]] std::span<uint64_t> output, [[maybe_unused]] uint64_t xor_mask,
+                                    [[maybe_unused]] int rot,
+                                    [[maybe_unused]] cppx::EndiannessPolicy auto endianness_policy)
+{
+#ifdef ARBA_RAND_X86_SIMD
+    const simd_isa isa = active_simd_isa();
+    const std::size_t count = output.size();
+    if (isa == simd_isa::scalar)
+        return 0;
+    const bool byte_swap = core::htow_when(uint64_t(1), endianness_policy) != uint64_t(1);
+    if (isa >= simd_isa::avx512)
+    {
+        if (byte_swap)
+            return xoron64_transform_avx512_<Beta, true>(input.data(), output.data(), count, xor_mask, rot);
+        return xoron64_transform_avx512_<Beta, false>(input.data(), output.data(), count, xor_mask, rot);
+    }
+    if (byte_swap)
+        return xoron64_transform_avx2_<Beta, true>(input.data(), output.data(), count, xor_mask, rot);
+    return xoron64_transform_avx2_<Beta, false>(input.data(), output.data(), count, xor_mask, rot);
+#else
+    return 0;
+#endif
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+#ifdef ARBA_RAND_X86_SIMD
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+#ifdef ARBA_RAND_X86_SIMD
+
+// Each vector holds one lane per state: a round advances every state once and stores LaneCount consecutive values,
+// which is exactly the interleaving of the scalar engines (value i comes from state i % LaneCount).
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx2"))) void xorshift64_lanes_avx2_(uint64_t* states, uint64_t* output, std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 4;
+    const __m256i byte_swap_mask =
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12,
+                         11, 10, 9, 8);
+    __m256i vstates[nb_vectors];
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        vstates[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states + v * 4));
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m256i x = vstates[v];
+            x = _mm256_xor_si256(x, _mm256_slli_epi64(x, 13));
+            x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 7));
+            x = _mm256_xor_si256(x, _mm256_slli_epi64(x, 17));
+            vstates[v] = x;
+            if constexpr (ByteSwap)
+                x = _mm256_shuffle_epi8(x, byte_swap_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + v * 4), x);
+        }
+    }
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + v * 4), vstates[v]);
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void xorshift64_lanes_avx512_(uint64_t* states, uint64_t* output,
+                                                                          std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 8;
+    const __m512i byte_swap_mask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    __m512i vstates[nb_vectors];
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        vstates[v] = _mm512_loadu_si512(states + v * 8);
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m512i x = vstates[v];
+            x = _mm512_xor_si512(x, _mm512_slli_epi64(x, 13));
+            x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 7));
+            x = _mm512_xor_si512(x, _mm512_slli_epi64(x, 17));
+            vstates[v] = x;
+            if constexpr (ByteSwap)
+                x = _mm512_shuffle_epi8(x, byte_swap_mask);
+            _mm512_storeu_si512(output + v * 8, x);
+        }
+    }
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        _mm512_storeu_si512(states + v * 8, vstates[v]);
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx2"))) void xorshift32_lanes_avx2_(uint32_t* states, uint32_t* output, std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 8;
+    const __m256i byte_swap_mask =
+        _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15,
+                         14, 13, 12);
+    __m256i vstates[nb_vectors];
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        vstates[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states + v * 8));
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m256i x = vstates[v];
+            x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 13));
+            x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+            x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+            vstates[v] = x;
+            if constexpr (ByteSwap)
+                x = _mm256_shuffle_epi8(x, byte_swap_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + v * 8), x);
+        }
+    }
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + v * 8), vstates[v]);
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void xorshift32_lanes_avx512_(uint32_t* states, uint32_t* output,
+                                                                          std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 16;
+    const __m512i byte_swap_mask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+    __m512i vstates[nb_vectors];
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        vstates[v] = _mm512_loadu_si512(states + v * 16);
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m512i x = vstates[v];
+            x = _mm512_xor_si512(x, _mm512_slli_epi32(x, 13));
+            x = _mm512_xor_si512(x, _mm512_srli_epi32(x, 17));
+            x = _mm512_xor_si512(x, _mm512_slli_epi32(x, 5));
+            vstates[v] = x;
+            if constexpr (ByteSwap)
+                x = _mm512_shuffle_epi8(x, byte_swap_mask);
+            _mm512_storeu_si512(output + v * 16, x);
+        }
+    }
+    for (std::size_t v = 0; v < nb_vectors; ++v)
+        _mm512_storeu_si512(states + v * 16, vstates[v]);
+}
+
+template <std::unsigned_integral UintT, std::size_t LaneCount, bool ByteSwap>
+std::size_t xorshift_lanes_simd_fill_(UintT* states, std::span<UintT> uints, simd_isa isa)
+{
+    constexpr std::size_t avx2_width = 32 / sizeof(UintT);
+    constexpr std::size_t avx512_width = 64 / sizeof(UintT);
+    const std::size_t rounds = uints.size() / LaneCount;
+    if constexpr (LaneCount % avx512_width == 0)
+    {
+        if (isa >= simd_isa::avx512)
+        {
+            if constexpr (sizeof(UintT) == sizeof(uint64_t))
+                xorshift64_lanes_avx512_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            else
+                xorshift32_lanes_avx512_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            return rounds * LaneCount;
+        }
+    }
+    if constexpr (LaneCount % avx2_width == 0)
+    {
+        if (isa >= simd_isa::avx2)
+        {
+            if constexpr (sizeof(UintT) == sizeof(uint64_t))
+                xorshift64_lanes_avx2_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            else
+                xorshift32_lanes_avx2_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            return rounds * LaneCount;
+        }
+    }
+    return 0;
+}
+
+#endif
+
+// Advances the LaneCount xorshift states over whole rounds of uints with the widest available SIMD kernel.
+// Returns the number of values written (a multiple of LaneCount, 0 if no kernel applies); the caller finishes the
+// remaining values with the scalar path.
+template <std::unsigned_integral UintT, std::size_t LaneCount>
+    requires(sizeof(UintT) == sizeof(uint32_t) || sizeof(UintT) == sizeof(uint64_t))
+std::size_t xorshift_lanes_fill_(UintT (&states)[LaneCount], std::span<UintT> uints,
+                                 [[maybe_unused]] cppx::EndiannessPolicy auto endianness_policy)
+{
+#ifdef ARBA_RAND_X86_SIMD
+    const simd_isa isa = active_simd_isa();
+    if (isa == simd_isa::scalar || uints.size() < LaneCount)
+        return 0;
+    if (core::htow_when(UintT(1), endianness_policy) != UintT(1))
+        return xorshift_lanes_simd_fill_<UintT, LaneCount, true>(states, uints, isa);
+    return xorshift_lanes_simd_fill_<UintT, LaneCount, false>(states, uints, isa);
+#else
+    return 0;
+#endif
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/core/bit/htow_when.hpp>
+#include <arba/cppx/policy/endianness_policy.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#ifdef ARBA_RAND_X86_SIMD
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+#ifdef ARBA_RAND_X86_SIMD
+
+// Each vector holds one word of the states of consecutive lanes (states[k * LaneCount + lane] is the word k of the
+// lane): a round advances every lane once and stores LaneCount consecutive values, which is exactly the interleaving
+// of the scalar range engines (value i comes from lane i % LaneCount).
+
+__attribute__((target("avx2"))) inline __m256i xoshiro_rotl_avx2_(__m256i x, int k)
+{
+    return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx2"))) void xoshiro256ss_lanes_avx2_(uint64_t* states, uint64_t* output, std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 4;
+    const __m256i byte_swap_mask =
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12,
+                         11, 10, 9, 8);
+    __m256i s[4][nb_vectors];
+    for (std::size_t k = 0; k < 4; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            s[k][v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states + k * LaneCount + v * 4));
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            // rotl(s1 * 5, 7) * 9, the products computed with shifts and additions.
+            __m256i x = _mm256_add_epi64(_mm256_slli_epi64(s[1][v], 2), s[1][v]);
+            x = xoshiro_rotl_avx2_(x, 7);
+            x = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);
+            const __m256i t = _mm256_slli_epi64(s[1][v], 17);
+            s[2][v] = _mm256_xor_si256(s[2][v], s[0][v]);
+            s[3][v] = _mm256_xor_si256(s[3][v], s[1][v]);
+            s[1][v] = _mm256_xor_si256(s[1][v], s[2][v]);
+            s[0][v] = _mm256_xor_si256(s[0][v], s[3][v]);
+            s[2][v] = _mm256_xor_si256(s[2][v], t);
+            s[3][v] = xoshiro_rotl_avx2_(s[3][v], 45);
+            if constexpr (ByteSwap)
+                x = _mm256_shuffle_epi8(x, byte_swap_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + v * 4), x);
+        }
+    }
+    for (std::size_t k = 0; k < 4; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + k * LaneCount + v * 4), s[k][v]);
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx2"))) void xoroshiro128plus_lanes_avx2_(uint64_t* states, uint64_t* output,
+                                                                  std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 4;
+    const __m256i byte_swap_mask =
+        _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12,
+                         11, 10, 9, 8);
+    __m256i s[2][nb_vectors];
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            s[k][v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states + k * LaneCount + v * 4));
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m256i x = _mm256_add_epi64(s[0][v], s[1][v]);
+            const __m256i s1 = _mm256_xor_si256(s[1][v], s[0][v]);
+            s[0][v] = _mm256_xor_si256(_mm256_xor_si256(xoshiro_rotl_avx2_(s[0][v], 24), s1),
+                                       _mm256_slli_epi64(s1, 16));
+            s[1][v] = xoshiro_rotl_avx2_(s1, 37);
+            if constexpr (ByteSwap)
+                x = _mm256_shuffle_epi8(x, byte_swap_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + v * 4), x);
+        }
+    }
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + k * LaneCount + v * 4), s[k][v]);
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void xoshiro256ss_lanes_avx512_(uint64_t* states, uint64_t* output,
+                                                                            std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 8;
+    const __m512i byte_swap_mask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    __m512i s[4][nb_vectors];
+    for (std::size_t k = 0; k < 4; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            s[k][v] = _mm512_loadu_si512(states + k * LaneCount + v * 8);
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m512i x = _mm512_add_epi64(_mm512_slli_epi64(s[1][v], 2), s[1][v]);
+            x = _mm512_rol_epi64(x, 7);
+            x = _mm512_add_epi64(_mm512_slli_epi64(x, 3), x);
+            const __m512i t = _mm512_slli_epi64(s[1][v], 17);
+            s[2][v] = _mm512_xor_si512(s[2][v], s[0][v]);
+            s[3][v] = _mm512_xor_si512(s[3][v], s[1][v]);
+            s[1][v] = _mm512_xor_si512(s[1][v], s[2][v]);
+            s[0][v] = _mm512_xor_si512(s[0][v], s[3][v]);
+            s[2][v] = _mm512_xor_si512(s[2][v], t);
+            s[3][v] = _mm512_rol_epi64(s[3][v], 45);
+            if constexpr (ByteSwap)
+                x = _mm512_shuffle_epi8(x, byte_swap_mask);
+            _mm512_storeu_si512(output + v * 8, x);
+        }
+    }
+    for (std::size_t k = 0; k < 4; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            _mm512_storeu_si512(states + k * LaneCount + v * 8, s[k][v]);
+}
+
+template <std::size_t LaneCount, bool ByteSwap>
+__attribute__((target("avx512f,avx512bw"))) void xoroshiro128plus_lanes_avx512_(uint64_t* states, uint64_t* output,
+                                                                                std::size_t rounds)
+{
+    constexpr std::size_t nb_vectors = LaneCount / 8;
+    const __m512i byte_swap_mask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    __m512i s[2][nb_vectors];
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            s[k][v] = _mm512_loadu_si512(states + k * LaneCount + v * 8);
+    for (; rounds > 0; --rounds, output += LaneCount)
+    {
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+        {
+            __m512i x = _mm512_add_epi64(s[0][v], s[1][v]);
+            const __m512i s1 = _mm512_xor_si512(s[1][v], s[0][v]);
+            s[0][v] = _mm512_ternarylogic_epi64(_mm512_rol_epi64(s[0][v], 24), s1, _mm512_slli_epi64(s1, 16),
+                                                0x96); // a ^ b ^ c
+            s[1][v] = _mm512_rol_epi64(s1, 37);
+            if constexpr (ByteSwap)
+                x = _mm512_shuffle_epi8(x, byte_swap_mask);
+            _mm512_storeu_si512(output + v * 8, x);
+        }
+    }
+    for (std::size_t k = 0; k < 2; ++k)
+        for (std::size_t v = 0; v < nb_vectors; ++v)
+            _mm512_storeu_si512(states + k * LaneCount + v * 8, s[k][v]);
+}
+
+template <std::size_t StateSize, std::size_t LaneCount, bool ByteSwap>
+std::size_t xoshiro_lanes_simd_fill_(uint64_t* states, std::span<uint64_t> uints, simd_isa isa)
+{
+    const std::size_t rounds = uints.size() / LaneCount;
+    if constexpr (LaneCount % 8 == 0)
+    {
+        if (isa >= simd_isa::avx512)
+        {
+            if constexpr (StateSize == 4)
+                xoshiro256ss_lanes_avx512_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            else
+                xoroshiro128plus_lanes_avx512_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            return rounds * LaneCount;
+        }
+    }
+    if constexpr (LaneCount % 4 == 0)
+    {
+        if (isa >= simd_isa::avx2)
+        {
+            if constexpr (StateSize == 4)
+                xoshiro256ss_lanes_avx2_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            else
+                xoroshiro128plus_lanes_avx2_<LaneCount, ByteSwap>(states, uints.data(), rounds);
+            return rounds * LaneCount;
+        }
+    }
+    return 0;
+}
+
+#endif
+
+// Advances the LaneCount xoshiro256** (4-word states) or xoroshiro128+ (2-word states) lanes over whole rounds of
+// uints with the widest available SIMD kernel. Returns the number of values written (a multiple of LaneCount, 0 if
+// no kernel applies); the caller finishes the remaining values with the scalar path.
+template <std::size_t StateSize, std::size_t LaneCount>
+    requires(StateSize == 4 || StateSize == 2)
+std::size_t xoshiro_lanes_fill_([[maybe_unused]] std::array<std::array<uint64_t, StateSize>, LaneCount>& lanes,
+                                [[maybe_unused]] std::span<uint64_t> uints,
+                                [[maybe_unused]] cppx::EndiannessPolicy auto endianness_policy)
+{
+#ifdef ARBA_RAND_X86_SIMD
+    const simd_isa isa = active_simd_isa();
+    if (isa == simd_isa::scalar || uints.size() < LaneCount)
+        return 0;
+    uint64_t states[StateSize * LaneCount];
+    for (std::size_t lane = 0; lane < LaneCount; ++lane)
+        for (std::size_t k = 0; k < StateSize; ++k)
+            states[k * LaneCount + lane] = lanes[lane][k];
+    const std::size_t size = core::htow_when(uint64_t(1), endianness_policy) != uint64_t(1)
+                                 ? xoshiro_lanes_simd_fill_<StateSize, LaneCount, true>(states, uints, isa)
+                                 : xoshiro_lanes_simd_fill_<StateSize, LaneCount, false>(states, uints, isa);
+    for (std::size_t lane = 0; lane < LaneCount; ++lane)
+        for (std::size_t k = 0; k < StateSize; ++k)
+            lanes[lane][k] = states[k * LaneCount + lane];
+    return size;
+#else
+    return 0;
+#endif
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
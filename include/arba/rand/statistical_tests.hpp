@@ -0,0 +1,641 @@
+#pragma once
+
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace rand
+{
+
+// Statistic of a test of a random sequence, and the probability of a statistic at least as extreme for a truly random
+// sequence: a p-value close to 0 (or to 1 for the one-sided tests) rejects the sequence. NaN when the sequence is too
+// short for the test.
+struct statistical_test_result
+{
+    double statistic = std::numeric_limits<double>::quiet_NaN();
+    double p_value = std::numeric_limits<double>::quiet_NaN();
+};
+
+enum class statistical_test : uint8_t
+{
+    chi_square_bytes,
+    chi_square_words16,
+    monobit,
+    runs,
+    serial_correlation,
+    entropy,
+    gap,
+    birthday_spacings,
+};
+
+inline constexpr std::size_t nb_statistical_tests = 8;
+
+inline constexpr std::array<statistical_test, nb_statistical_tests> statistical_tests = {
+    statistical_test::chi_square_bytes,   statistical_test::chi_square_words16, statistical_test::monobit,
+    statistical_test::runs,               statistical_test::serial_correlation, statistical_test::entropy,
+    statistical_test::gap,                statistical_test::birthday_spacings,
+};
+
+[[nodiscard]] constexpr std::string_view to_string(statistical_test test)
+{
+    switch (test)
+    {
+    case statistical_test::chi_square_bytes:
+        return "chi_square_bytes";
+    case statistical_test::chi_square_words16:
+        return "chi_square_words16";
+    case statistical_test::monobit:
+        return "monobit";
+    case statistical_test::runs:
+        return "runs";
+    case statistical_test::serial_correlation:
+        return "serial_correlation";
+    case statistical_test::entropy:
+        return "entropy";
+    case statistical_test::gap:
+        return "gap";
+    default:
+        return "birthday_spacings";
+    }
+}
+
+namespace private_
+{
+
+// Regularized incomplete gamma functions P(a, x) and Q(a, x) = 1 - P(a, x): the series of P converges quickly for
+// x < a + 1, the continued fraction of Q (modified Lentz) for the other values. Each one is computed directly, to
+// keep the precision of the small p-values.
+inline double gamma_series_(double a, double x)
+{
+    double term = 1. / a;
+    double sum = term;
+    for (unsigned n = 1; n < 1'000'000; ++n)
+    {
+        term *= x / (a + n);
+        sum += term;
+        if (term < sum * 1e-16)
+            break;
+    }
+    return sum * std::exp(a * std::log(x) - x - std::lgamma(a));
+}
+
+inline double gamma_continued_fraction_(double a, double x)
+{
+    constexpr double tiny = 1e-300;
+    double b = x + 1. - a;
+    double c = 1. / tiny;
+    double d = 1. / b;
+    double fraction = d;
+    for (unsigned i = 1; i < 1'000'000; ++i)
+    {
+        const double an = -double(i) * (double(i) - a);
+        b += 2.;
+        d = an * d + b;
+        d = std::abs(d) < tiny ? tiny : d;
+        c = b + an / c;
+        c = std::abs(c) < tiny ? tiny : c;
+        d = 1. / d;
+        const double delta = d * c;
+        fraction *= delta;
+        if (std::abs(delta - 1.) < 1e-16)
+            break;
+    }
+    return fraction * std::exp(a * std::log(x) - x - std::lgamma(a));
+}
+
+inline double regularized_gamma_p_(double a, double x)
+{
+    if (x <= 0.)
+        return 0.;
+    return x < a + 1. ? gamma_series_(a, x) : 1. - gamma_continued_fraction_(a, x);
+}
+
+inline double regularized_gamma_q_(double a, double x)
+{
+    if (x <= 0.)
+        return 1.;
+    return x < a + 1. ? 1. - gamma_series_(a, x) : gamma_continued_fraction_(a, x);
+}
+
+// Probability that a chi-square variable with the degrees of freedom exceeds the statistic.
+inline double chi_square_p_value_(double statistic, double degrees_of_freedom)
+{
+    return regularized_gamma_q_(degrees_of_freedom / 2., statistic / 2.);
+}
+
+// Probability that the absolute value of a standard normal variable exceeds the absolute value of z.
+inline double normal_two_sided_p_value_(double z) { return std::erfc(std::abs(z) / std::sqrt(2.)); }
+
+inline statistical_test_result chi_square_test_(std::span<const uint64_t> counts)
+{
+    const uint64_t nb_values = std::reduce(counts.begin(), counts.end(), uint64_t(0));
+    const double expected_count = double(nb_values) / counts.size();
+    if (expected_count < 5.)
+        return {};
+    double statistic = 0.;
+    for (const uint64_t count : counts)
+        statistic += (double(count) - expected_count) * (double(count) - expected_count);
+    statistic /= expected_count;
+    return { statistic, chi_square_p_value_(statistic, double(counts.size() - 1)) };
+}
+
+// Bytes cut in at most max_nb_chunks chunks of at least min_chunk_size bytes (multiples of 8 bytes, except the last
+// one), the result of chunk_fn(chunk, offset) for each chunk being computed with the execution policy.
+template <class ChunkResultT>
+std::vector<ChunkResultT> map_chunks_(std::span<const std::byte> bytes, cppx::ExecutionPolicy auto execution_policy,
+                                      auto chunk_fn)
+{
+    constexpr std::size_t min_chunk_size = 1024 * 1024;
+    constexpr std::size_t max_nb_chunks = 64;
+
+    const std::size_t chunk_size =
+        std::max(min_chunk_size, ((bytes.size() + max_nb_chunks - 1) / max_nb_chunks + 7) / 8 * 8);
+    const std::size_t nb_chunks = std::max<std::size_t>((bytes.size() + chunk_size - 1) / chunk_size, 1);
+    std::vector<ChunkResultT> results(nb_chunks);
+    std::vector<std::size_t> chunk_indexes(nb_chunks);
+    std::iota(chunk_indexes.begin(), chunk_indexes.end(), 0);
+    std::for_each(execution_policy, chunk_indexes.cbegin(), chunk_indexes.cend(),
+                  [&](std::size_t chunk_index)
+                  {
+                      const std::size_t offset = std::min(chunk_index * chunk_size, bytes.size());
+                      results[chunk_index] =
+                          chunk_fn(bytes.subspan(offset, std::min(chunk_size, bytes.size() - offset)), offset);
+                  });
+    return results;
+}
+
+// Big-endian word, whatever the host: the first byte holds the most significant bits, the bits of the sequence being
+// read from the most significant bit of each byte. A load and a byte swap: GCC keeps the loop of bytes at -O2.
+template <std::unsigned_integral WordT>
+inline WordT load_big_endian_(const std::byte* bytes)
+{
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        WordT word;
+        std::memcpy(&word, bytes, sizeof(WordT));
+        return word;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    else if constexpr (std::endian::native == std::endian::little && (sizeof(WordT) == 4 || sizeof(WordT) == 8))
+    {
+        WordT word;
+        std::memcpy(&word, bytes, sizeof(WordT));
+        if constexpr (sizeof(WordT) == 4)
+            return __builtin_bswap32(word);
+        else
+            return __builtin_bswap64(word);
+    }
+#endif
+    else
+    {
+        WordT word = 0;
+        for (std::size_t i = 0; i < sizeof(WordT); ++i)
+            word = WordT(word << 8) | WordT(bytes[i]);
+        return word;
+    }
+}
+
+using byte_counts_ = std::array<uint64_t, 256>;
+
+// Four interleaved tables, so that consecutive equal bytes do not wait for each other's increment.
+inline byte_counts_ count_bytes_(std::span<const std::byte> bytes)
+{
+    std::array<byte_counts_, 4> tables{};
+    std::size_t i = 0;
+    for (; i + 4 <= bytes.size(); i += 4)
+    {
+        ++tables[0][uint8_t(bytes[i])];
+        ++tables[1][uint8_t(bytes[i + 1])];
+        ++tables[2][uint8_t(bytes[i + 2])];
+        ++tables[3][uint8_t(bytes[i + 3])];
+    }
+    for (; i < bytes.size(); ++i)
+        ++tables[0][uint8_t(bytes[i])];
+    for (std::size_t value = 0; value < 256; ++value)
+        tables[0][value] += tables[1][value] + tables[2][value] + tables[3][value];
+    return tables[0];
+}
+
+} // namespace private_
+
+// Number of occurrences of each byte value.
+std::array<uint64_t, 256> byte_counts(std::span<const std::byte> bytes, cppx::ExecutionPolicy auto execution_policy)
+{
+    const std::vector chunk_counts = private_::map_chunks_<private_::byte_counts_>(
+        bytes, execution_policy,
+        [](std::span<const std::byte> chunk, std::size_t) { return private_::count_bytes_(chunk); });
+    private_::byte_counts_ counts{};
+    for (const private_::byte_counts_& chunk_count : chunk_counts)
+        std::ranges::transform(counts, chunk_count, counts.begin(), std::plus<>());
+    return counts;
+}
+
+// Chi-square test of the uniformity of the bytes (255 degrees of freedom).
+statistical_test_result chi_square_bytes_test(std::span<const std::byte> bytes,
+                                              cppx::ExecutionPolicy auto execution_policy)
+{
+    const std::array counts = byte_counts(bytes, execution_policy);
+    return private_::chi_square_test_(counts);
+}
+
+// Chi-square test of the uniformity of the 16-bit words (big-endian pairs of bytes, 65535 degrees of freedom): needs
+// at least 640 KiB.
+statistical_test_result chi_square_words16_test(std::span<const std::byte> bytes,
+                                                cppx::ExecutionPolicy auto execution_policy)
+{
+    const std::vector chunk_counts = private_::map_chunks_<std::vector<uint64_t>>(
+        bytes, execution_policy,
+        [](std::span<const std::byte> chunk, std::size_t)
+        {
+            std::vector<uint64_t> counts(65536, 0);
+            std::size_t i = 0;
+            for (; i + 8 <= chunk.size(); i += 8)
+            {
+                const uint64_t word = private_::load_big_endian_<uint64_t>(chunk.data() + i);
+                ++counts[word >> 48];
+                ++counts[(word >> 32) & 0xffff];
+                ++counts[(word >> 16) & 0xffff];
+                ++counts[word & 0xffff];
+            }
+            for (; i + 2 <= chunk.size(); i += 2)
+                ++counts[(std::size_t(chunk[i]) << 8) | std::size_t(chunk[i + 1])];
+            return counts;
+        });
+    std::vector<uint64_t> counts(65536, 0);
+    for (const std::vector<uint64_t>& chunk_count : chunk_counts)
+        std::ranges::transform(counts, chunk_count, counts.begin(), std::plus<>());
+    return private_::chi_square_test_(counts);
+}
+
+// Frequency test of NIST SP 800-22: the statistic is (ones - zeros) / sqrt(bits), a standard normal variable.
+statistical_test_result monobit_test(std::span<const std::byte> bytes, cppx::ExecutionPolicy auto execution_policy)
+{
+    if (bytes.empty())
+        return {};
+    const std::vector chunk_ones = private_::map_chunks_<uint64_t>(
+        bytes, execution_policy,
+        [](std::span<const std::byte> chunk, std::size_t)
+        {
+            uint64_t ones = 0;
+            std::size_t i = 0;
+            for (; i + 8 <= chunk.size(); i += 8)
+                ones += std::popcount(private_::load_big_endian_<uint64_t>(chunk.data() + i));
+            for (; i < chunk.size(); ++i)
+                ones += std::popcount(uint8_t(chunk[i]));
+            return ones;
+        });
+    const double nb_bits = 8. * bytes.size();
+    const double ones = double(std::reduce(chunk_ones.cbegin(), chunk_ones.cend(), uint64_t(0)));
+    const double statistic = (2. * ones - nb_bits) / std::sqrt(nb_bits);
+    return { statistic, private_::normal_two_sided_p_value_(statistic) };
+}
+
+// Runs test of NIST SP 800-22: the number of runs of identical bits (one plus the number of changes between
+// consecutive bits, the bits of a byte being read from the most significant one) compared to its expectation. The
+// p-value is 0 when the proportion of ones already fails the frequency test.
+statistical_test_result runs_test(std::span<const std::byte> bytes, cppx::ExecutionPolicy auto execution_policy)
+{
+    struct chunk_counts
+    {
+        uint64_t ones = 0;
+        uint64_t changes = 0;
+    };
+
+    if (bytes.empty())
+        return {};
+    // The change between the last bit of a chunk and the first one of the next is counted with the chunk.
+    const std::vector counts = private_::map_chunks_<chunk_counts>(
+        bytes, execution_policy,
+        [bytes](std::span<const std::byte> chunk, std::size_t offset)
+        {
+            chunk_counts counts;
+            std::size_t i = 0;
+            for (; i + 8 <= chunk.size(); i += 8)
+            {
+                const uint64_t word = private_::load_big_endian_<uint64_t>(chunk.data() + i);
+                counts.ones += std::popcount(word);
+                counts.changes += std::popcount((word ^ (word >> 1)) & ~(uint64_t(1) << 63));
+                if (offset + i + 8 < bytes.size())
+                    counts.changes += (word & 1) != (uint8_t(bytes[offset + i + 8]) >> 7);
+            }
+            for (; i < chunk.size(); ++i)
+            {
+                const uint8_t byte = uint8_t(chunk[i]);
+                counts.ones += std::popcount(byte);
+                counts.changes += std::popcount(uint8_t((byte ^ (byte >> 1)) & 0x7f));
+                if (offset + i + 1 < bytes.size())
+                    counts.changes += (byte & 1) != (uint8_t(bytes[offset + i + 1]) >> 7);
+            }
+            return counts;
+        });
+
+    uint64_t ones = 0;
+    uint64_t changes = 0;
+    for (const chunk_counts& chunk_count : counts)
+    {
+        ones += chunk_count.ones;
+        changes += chunk_count.changes;
+    }
+    const double nb_bits = 8. * bytes.size();
+    const double proportion = ones / nb_bits;
+    const double statistic = double(changes + 1);
+    if (std::abs(proportion - 0.5) >= 2. / std::sqrt(nb_bits))
+        return { statistic, 0. };
+    const double variance_factor = proportion * (1. - proportion);
+    const double z = (statistic - 2. * nb_bits * variance_factor) / (2. * std::sqrt(2. * nb_bits) * variance_factor);
+    return { statistic, std::erfc(std::abs(z)) };
+}
+
+// Serial correlation coefficient of the consecutive bytes (the last one being followed by the first one, as in the
+// ent program): about a normal variable of variance 1 / size for a random sequence.
+statistical_test_result serial_correlation_test(std::span<const std::byte> bytes,
+                                                cppx::ExecutionPolicy auto execution_policy)
+{
+    struct chunk_sums
+    {
+        uint64_t sum = 0;
+        uint64_t sum_of_squares = 0;
+        uint64_t sum_of_products = 0;
+    };
+
+    if (bytes.size() < 2)
+        return {};
+    const std::vector sums = private_::map_chunks_<chunk_sums>(
+        bytes, execution_policy,
+        [bytes](std::span<const std::byte> chunk, std::size_t offset)
+        {
+            chunk_sums sums;
+            // 32-bit sums of blocks of 65536 bytes (255^2 * 65536 < 2^32), which the compiler vectorizes.
+            constexpr std::size_t block_size = 65536;
+            for (std::size_t offset = 0; offset + 1 < chunk.size(); offset += block_size)
+            {
+                const std::size_t end = std::min(offset + block_size, chunk.size() - 1);
+                uint32_t sum = 0;
+                uint32_t sum_of_squares = 0;
+                uint32_t sum_of_products = 0;
+                for (std::size_t i = offset; i < end; ++i)
+                {
+                    const uint32_t value = uint8_t(chunk[i]);
+                    sum += value;
+                    sum_of_squares += value * value;
+                    sum_of_products += value * uint8_t(chunk[i + 1]);
+                }
+                sums.sum += sum;
+                sums.sum_of_squares += sum_of_squares;
+                sums.sum_of_products += sum_of_products;
+            }
+            const uint64_t last_value = uint8_t(chunk.back());
+            sums.sum += last_value;
+            sums.sum_of_squares += last_value * last_value;
+            sums.sum_of_products += last_value * uint8_t(bytes[(offset + chunk.size()) % bytes.size()]);
+            return sums;
+        });
+
+    chunk_sums total;
+    for (const chunk_sums& chunk_sum : sums)
+    {
+        total.sum += chunk_sum.sum;
+        total.sum_of_squares += chunk_sum.sum_of_squares;
+        total.sum_of_products += chunk_sum.sum_of_products;
+    }
+    const double size = double(bytes.size());
+    const double squared_sum = double(total.sum) * double(total.sum);
+    const double denominator = size * double(total.sum_of_squares) - squared_sum;
+    if (denominator == 0.)
+        return { 1., 0. };
+    const double statistic = (size * double(total.sum_of_products) - squared_sum) / denominator;
+    return { statistic, private_::normal_two_sided_p_value_(statistic * std::sqrt(size)) };
+}
+
+// Shannon entropy of the bytes, in bits per byte (8 at most). Its p-value is the one of the G-test of uniformity,
+// whose statistic 2 * size * (ln(256) - entropy * ln(2)) follows a chi-square distribution with 255 degrees of freedom.
+statistical_test_result entropy_test(std::span<const std::byte> bytes, cppx::ExecutionPolicy auto execution_policy)
+{
+    if (bytes.size() < 5 * 256)
+        return {};
+    const std::array counts = byte_counts(bytes, execution_policy);
+    const double size = double(bytes.size());
+    double entropy = 0.;
+    for (const uint64_t count : counts)
+    {
+        if (count > 0)
+        {
+            const double probability = count / size;
+            entropy -= probability * std::log2(probability);
+        }
+    }
+    const double g_statistic = std::max(2. * size * (std::log(256.) - entropy * std::log(2.)), 0.);
+    return { entropy, private_::chi_square_p_value_(g_statistic, 255.) };
+}
+
+// Gap test of Knuth: the lengths of the gaps between the bytes lower than 16 (probability 1/16) follow a geometric
+// distribution. The lengths 0 to 63 and the longer ones are compared with a chi-square test (64 degrees of freedom),
+// whose statistic is returned.
+statistical_test_result gap_test(std::span<const std::byte> bytes, cppx::ExecutionPolicy auto execution_policy)
+{
+    static constexpr std::size_t max_gap = 64;
+    constexpr uint8_t hit_bound = 16;
+    constexpr std::size_t no_hit = std::numeric_limits<std::size_t>::max();
+
+    // Gaps of the chunk, and the lengths of the runs without hit before its first hit and after its last hit.
+    struct chunk_gaps
+    {
+        std::array<uint64_t, max_gap + 1> counts{};
+        std::size_t leading_length = no_hit;
+        std::size_t trailing_length = 0;
+    };
+
+    const std::vector gaps = private_::map_chunks_<chunk_gaps>(
+        bytes, execution_policy,
+        [](std::span<const std::byte> chunk, std::size_t)
+        {
+            chunk_gaps gaps;
+            std::size_t length = 0;
+            const auto end_gap = [&gaps, &length]
+            {
+                if (gaps.leading_length == no_hit)
+                    gaps.leading_length = length;
+                else
+                    ++gaps.counts[std::min(length, max_gap)];
+                length = 0;
+            };
+            // 8 bytes at a time: the high bit of a byte of hits is set when the high nibble of the byte is null (the
+            // additions do not carry across the bytes), and (15/16)^8 = 60% of the words have no hit at all.
+            constexpr uint64_t high_nibbles = 0xf0f0f0f0f0f0f0f0ull;
+            constexpr uint64_t low_bits = 0x7f7f7f7f7f7f7f7full;
+            static_assert(hit_bound == 16);
+            std::size_t i = 0;
+            for (; i + 8 <= chunk.size(); i += 8)
+            {
+                const uint64_t nibbles = private_::load_big_endian_<uint64_t>(chunk.data() + i) & high_nibbles;
+                uint64_t hits = ~(((nibbles & low_bits) + low_bits) | nibbles | low_bits);
+                std::size_t position = 0;
+                while (hits != 0)
+                {
+                    const int leading_zeros = std::countl_zero(hits);
+                    const std::size_t hit_position = std::size_t(leading_zeros) / 8;
+                    length += hit_position - position;
+                    end_gap();
+                    position = hit_position + 1;
+                    hits ^= (uint64_t(1) << 63) >> leading_zeros;
+                }
+                length += 8 - position;
+            }
+            for (; i < chunk.size(); ++i)
+            {
+                if (uint8_t(chunk[i]) < hit_bound)
+                    end_gap();
+                else
+                    ++length;
+            }
+            gaps.trailing_length = length;
+            return gaps;
+        });
+
+    std::array<uint64_t, max_gap + 1> counts{};
+    std::size_t pending_length = no_hit;
+    for (const chunk_gaps& chunk_gap : gaps)
+    {
+        std::ranges::transform(counts, chunk_gap.counts, counts.begin(), std::plus<>());
+        if (chunk_gap.leading_length == no_hit)
+        {
+            if (pending_length != no_hit)
+                pending_length += chunk_gap.trailing_length;
+            continue;
+        }
+        if (pending_length != no_hit)
+            ++counts[std::min(pending_length + chunk_gap.leading_length, max_gap)];
+        pending_length = chunk_gap.trailing_length;
+    }
+
+    const double nb_gaps = double(std::reduce(counts.cbegin(), counts.cend(), uint64_t(0)));
+    constexpr double hit_probability = hit_bound / 256.;
+    // The smallest expected count is the one of the longest gap below max_gap, p(1-p)^63 (the cell of the longer ones
+    // expects (1-p)^64): about 4700 gaps (72 KiB) are needed for the chi-square approximation.
+    if (nb_gaps * hit_probability * std::pow(1. - hit_probability, double(max_gap - 1)) < 5.)
+        return {};
+    double statistic = 0.;
+    for (std::size_t length = 0; length <= max_gap; ++length)
+    {
+        const double probability = length < max_gap
+                                       ? hit_probability * std::pow(1. - hit_probability, double(length))
+                                       : std::pow(1. - hit_probability, double(max_gap));
+        const double expected_count = nb_gaps * probability;
+        statistic += (counts[length] - expected_count) * (counts[length] - expected_count) / expected_count;
+    }
+    return { statistic, private_::chi_square_p_value_(statistic, double(max_gap)) };
+}
+
+namespace private_
+{
+
+// LSD radix sort of the values, one byte per pass, the histograms of the four passes being counted at once: random
+// values are sorted without the mispredicted branches of the comparison sorts.
+inline void radix_sort_(std::span<uint32_t> values, std::span<uint32_t> buffer)
+{
+    std::array<std::array<uint32_t, 256>, 4> offsets{};
+    for (const uint32_t value : values)
+        for (unsigned pass = 0; pass < 4; ++pass)
+            ++offsets[pass][(value >> (8 * pass)) & 0xff];
+    for (std::array<uint32_t, 256>& pass_offsets : offsets)
+        std::exclusive_scan(pass_offsets.cbegin(), pass_offsets.cend(), pass_offsets.begin(), uint32_t(0));
+
+    std::span<uint32_t> source = values;
+    std::span<uint32_t> destination = buffer;
+    for (unsigned pass = 0; pass < 4; ++pass)
+    {
+        for (const uint32_t value : source)
+            destination[offsets[pass][(value >> (8 * pass)) & 0xff]++] = value;
+        std::swap(source, destination);
+    }
+}
+
+} // namespace private_
+
+// Birthday spacings test of Marsaglia: in each sample of 4096 birthdays (big-endian 32-bit words) in a year of 2^32
+// days, the number of repeated values among the spacings of the sorted birthdays follows a Poisson distribution of
+// mean 4096^3 / 2^34 = 4. The statistic is the total number of repetitions in the samples, and the p-value the
+// probability of at least as many repetitions (one-sided: too many repetitions reveal a lattice structure). Needs at
+// least 16 KiB.
+statistical_test_result birthday_spacings_test(std::span<const std::byte> bytes,
+                                               cppx::ExecutionPolicy auto execution_policy)
+{
+    constexpr std::size_t nb_birthdays = 4096;
+    constexpr double mean_repetitions = 4.;
+    constexpr std::size_t sample_size = nb_birthdays * sizeof(uint32_t);
+
+    const std::size_t nb_samples = bytes.size() / sample_size;
+    if (nb_samples == 0)
+        return {};
+    std::vector<std::size_t> sample_indexes(nb_samples);
+    std::iota(sample_indexes.begin(), sample_indexes.end(), 0);
+    const uint64_t nb_repetitions = std::transform_reduce(
+        execution_policy, sample_indexes.cbegin(), sample_indexes.cend(), uint64_t(0), std::plus<>(),
+        [bytes](std::size_t sample_index)
+        {
+            std::array<uint32_t, nb_birthdays> birthdays;
+            std::array<uint32_t, nb_birthdays> buffer;
+            const std::byte* const sample = bytes.data() + sample_index * sample_size;
+            for (std::size_t i = 0; i < nb_birthdays; ++i)
+                birthdays[i] = private_::load_big_endian_<uint32_t>(sample + i * sizeof(uint32_t));
+            private_::radix_sort_(std::span(birthdays), std::span(buffer));
+            std::adjacent_difference(birthdays.begin(), birthdays.end(), birthdays.begin());
+            private_::radix_sort_(std::span(birthdays), std::span(buffer));
+            uint64_t repetitions = 0;
+            for (std::size_t i = 1; i < nb_birthdays; ++i)
+                repetitions += birthdays[i] == birthdays[i - 1];
+            return repetitions;
+        });
+    const double statistic = double(nb_repetitions);
+    // P(X >= k) = P(k, mean) for a Poisson variable X.
+    const double p_value =
+        nb_repetitions == 0 ? 1. : private_::regularized_gamma_p_(statistic, mean_repetitions * nb_samples);
+    return { statistic, p_value };
+}
+
+statistical_test_result run_statistical_test(statistical_test test, std::span<const std::byte> bytes,
+                                             cppx::ExecutionPolicy auto execution_policy)
+{
+    switch (test)
+    {
+    case statistical_test::chi_square_bytes:
+        return chi_square_bytes_test(bytes, execution_policy);
+    case statistical_test::chi_square_words16:
+        return chi_square_words16_test(bytes, execution_policy);
+    case statistical_test::monobit:
+        return monobit_test(bytes, execution_policy);
+    case statistical_test::runs:
+        return runs_test(bytes, execution_policy);
+    case statistical_test::serial_correlation:
+        return serial_correlation_test(bytes, execution_policy);
+    case statistical_test::entropy:
+        return entropy_test(bytes, execution_policy);
+    case statistical_test::gap:
+        return gap_test(bytes, execution_policy);
+    default:
+        return birthday_spacings_test(bytes, execution_policy);
+    }
+}
+
+inline statistical_test_result run_statistical_test(statistical_test test, std::span<const std::byte> bytes)
+{
+    return run_statistical_test(test, bytes, std::execution::seq);
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+
+inline namespace arba
+{
+namespace rand
+{
+
+using threefry2x64_counter = std::array<uint64_t, 2>;
+using threefry2x64_key = std::array<uint64_t, 2>;
+
+// Threefry2x64 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"): the Threefish block cipher reduced to
+// additions, rotations and xors, keyed bijection of 128-bit counters. The key is injected every 4 rounds.
+template <unsigned Rounds = 20>
+constexpr threefry2x64_counter threefry2x64(threefry2x64_counter counter, threefry2x64_key key)
+{
+    constexpr std::array rotations = { 16, 42, 12, 31, 16, 32, 24, 21 };
+    const std::array<uint64_t, 3> key_schedule = { key[0], key[1], 0x1BD11BDAA9FC1A22ull ^ key[0] ^ key[1] };
+
+    uint64_t x0 = counter[0] + key_schedule[0];
+    uint64_t x1 = counter[1] + key_schedule[1];
+    // Rounds unrolled, for the rotations to be constants.
+    const auto round_fn = [&]<unsigned Round>(std::integral_constant<unsigned, Round>)
+    {
+        x0 += x1;
+        x1 = std::rotl(x1, rotations[Round % 8]) ^ x0;
+        if constexpr (Round % 4 == 3)
+        {
+            constexpr unsigned injection = (Round + 1) / 4;
+            x0 += key_schedule[injection % 3];
+            x1 += key_schedule[(injection + 1) % 3] + injection;
+        }
+    };
+    [&]<unsigned... RoundIndexes>(std::integer_sequence<unsigned, RoundIndexes...>)
+    {
+        (round_fn(std::integral_constant<unsigned, RoundIndexes>()), ...);
+    }(std::make_integer_sequence<unsigned, Rounds>());
+    return { x0, x1 };
+}
+
+} // namespace rand
+} // namespace arba
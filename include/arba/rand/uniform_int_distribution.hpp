@@ -0,0 +1,266 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+#if defined(__SIZEOF_INT128__) && (defined(__GNUC__) || defined(__clang__))
+// 128-bit integers are a GCC and Clang extension, which __extension__ keeps quiet under -Wpedantic.
+__extension__ typedef unsigned __int128 uint128_t_;
+#endif
+
+// Unsigned type holding the full product of two UintT.
+template <std::unsigned_integral UintT>
+struct wide_uint_;
+
+template <>
+struct wide_uint_<uint32_t>
+{
+    using type = uint64_t;
+};
+
+#if defined(__SIZEOF_INT128__) && (defined(__GNUC__) || defined(__clang__))
+template <>
+struct wide_uint_<uint64_t>
+{
+    using type = uint128_t_;
+};
+#endif
+
+// High and low halves of the full product of two 32-bit or 64-bit unsigned integers.
+template <std::unsigned_integral UintT>
+struct wide_product_
+{
+    UintT high;
+    UintT low;
+};
+
+template <std::unsigned_integral UintT>
+inline wide_product_<UintT> multiply_wide_(UintT x, UintT y)
+{
+    if constexpr (std::numeric_limits<UintT>::digits == 32)
+    {
+        const uint64_t product = uint64_t(x) * y;
+        return { static_cast<UintT>(product >> 32), static_cast<UintT>(product) };
+    }
+    else
+    {
+        static_assert(std::numeric_limits<UintT>::digits == 64);
+#if defined(__SIZEOF_INT128__) && (defined(__GNUC__) || defined(__clang__))
+        const uint128_t_ product = uint128_t_(x) * y;
+        return { static_cast<UintT>(product >> 64), static_cast<UintT>(product) };
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned __int64 high;
+        const unsigned __int64 low = _umul128(x, y, &high);
+        return { static_cast<UintT>(high), static_cast<UintT>(low) };
+#else
+        const uint64_t x_high = x >> 32, x_low = uint32_t(x), y_high = y >> 32, y_low = uint32_t(y);
+        const uint64_t low_low = x_low * y_low;
+        const uint64_t high_low = x_high * y_low + (low_low >> 32);
+        const uint64_t low_high = x_low * y_high + uint32_t(high_low);
+        return { static_cast<UintT>(x_high * y_high + (high_low >> 32) + (low_high >> 32)),
+                 static_cast<UintT>((low_high << 32) | uint32_t(low_low)) };
+#endif
+    }
+}
+
+} // namespace private_
+
+#ifdef ARBA_RAND_STD_UNIFORM_INT_DISTRIBUTION
+
+// Keeps the sequences of the versions using the standard library distribution.
+template <std::integral IntType = int>
+using uniform_int_distribution = std::uniform_int_distribution<IntType>;
+
+#else
+
+namespace private_
+{
+
+template <std::uniform_random_bit_generator UrngT>
+inline constexpr unsigned urng_full_range_digits_ =
+    (UrngT::min() == 0 && UrngT::max() == std::numeric_limits<uint64_t>::max())   ? 64
+    : (UrngT::min() == 0 && UrngT::max() == std::numeric_limits<uint32_t>::max()) ? 32
+                                                                                   : 0;
+
+template <std::unsigned_integral UintT, std::uniform_random_bit_generator UrngT>
+inline UintT draw_uint_(UrngT& rng)
+{
+    constexpr unsigned urng_digits = urng_full_range_digits_<UrngT>;
+    static_assert(urng_digits >= std::numeric_limits<UintT>::digits);
+    if constexpr (urng_digits == std::numeric_limits<UintT>::digits)
+        return static_cast<UintT>(rng());
+    else
+        return static_cast<UintT>(static_cast<uint64_t>(rng()) >> (urng_digits - std::numeric_limits<UintT>::digits));
+}
+
+// Uniform value in [0, range] with Lemire's nearly divisionless method: the high half of x * (range + 1) is the
+// result, and the low half tells when x falls in the biased zone (probability below range / 2^digits).
+template <std::unsigned_integral UintT, std::uniform_random_bit_generator UrngT>
+inline UintT bounded_uint_(UrngT& rng, UintT range)
+{
+    constexpr unsigned digits = std::numeric_limits<UintT>::digits;
+
+    if constexpr (urng_full_range_digits_<UrngT> == 0 || (digits != 32 && digits != 64))
+    {
+        return std::uniform_int_distribution<UintT>(0, range)(rng);
+    }
+    else if constexpr (urng_full_range_digits_<UrngT> > digits)
+    {
+        // Keeps all the bits of the draw: the biased zone shrinks to range / 2^64.
+        return static_cast<UintT>(bounded_uint_<uint64_t>(rng, uint64_t(range)));
+    }
+    else if constexpr (urng_full_range_digits_<UrngT> == 32 && digits == 64)
+    {
+        // Same draws as libstdc++: a single 32-bit draw when the range fits, otherwise the high half drawn in
+        // [0, range >> 32] followed by the low half, rejected when the value exceeds the range.
+        if (range <= std::numeric_limits<uint32_t>::max())
+            return bounded_uint_<uint32_t>(rng, uint32_t(range));
+        for (;;)
+        {
+            const uint64_t high = uint64_t(bounded_uint_<uint32_t>(rng, uint32_t(range >> 32))) << 32;
+            const uint64_t value = high | static_cast<uint32_t>(rng());
+            if (value <= range)
+                return value;
+        }
+    }
+    else
+    {
+        if (range == std::numeric_limits<UintT>::max()) [[unlikely]]
+            return draw_uint_<UintT>(rng);
+        const UintT bound = range + 1;
+        wide_product_<UintT> product = multiply_wide_<UintT>(draw_uint_<UintT>(rng), bound);
+        if (product.low < bound) [[unlikely]]
+        {
+            const UintT threshold = static_cast<UintT>(-bound) % bound;
+            while (product.low < threshold)
+                product = multiply_wide_<UintT>(draw_uint_<UintT>(rng), bound);
+        }
+        return product.high;
+    }
+}
+
+} // namespace private_
+
+// Drop-in replacement of std::uniform_int_distribution drawing values with multiply-high and rare rejections
+// instead of divisions. Define ARBA_RAND_STD_UNIFORM_INT_DISTRIBUTION to get back the standard distribution.
+template <std::integral IntType = int>
+class uniform_int_distribution
+{
+public:
+    using result_type = IntType;
+
+    class param_type
+    {
+    public:
+        using distribution_type = uniform_int_distribution;
+
+        constexpr param_type() : param_type(0) {}
+
+        constexpr explicit param_type(result_type a, result_type b = std::numeric_limits<result_type>::max())
+            : a_(a), b_(b)
+        {
+        }
+
+        [[nodiscard]] constexpr result_type a() const { return a_; }
+        [[nodiscard]] constexpr result_type b() const { return b_; }
+
+        friend constexpr bool operator==(const param_type&, const param_type&) = default;
+
+    private:
+        result_type a_;
+        result_type b_;
+    };
+
+private:
+    using uint_type_ = std::conditional_t<(sizeof(IntType) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+    // Type read and written by the streams: the values of the char types are numbers, not characters.
+    using io_type_ = decltype(+result_type());
+
+public:
+    constexpr uniform_int_distribution() : uniform_int_distribution(0) {}
+
+    constexpr explicit uniform_int_distribution(result_type a,
+                                                result_type b = std::numeric_limits<result_type>::max())
+        : param_(a, b)
+    {
+    }
+
+    constexpr explicit uniform_int_distribution(const param_type& param) : param_(param) {}
+
+    constexpr void reset() {}
+
+    [[nodiscard]] constexpr result_type a() const { return param_.a(); }
+    [[nodiscard]] constexpr result_type b() const { return param_.b(); }
+    [[nodiscard]] constexpr result_type min() const { return param_.a(); }
+    [[nodiscard]] constexpr result_type max() const { return param_.b(); }
+
+    [[nodiscard]] constexpr param_type param() const { return param_; }
+    constexpr void param(const param_type& param) { param_ = param; }
+
+    template <std::uniform_random_bit_generator UrngT>
+    result_type operator()(UrngT& rng) const
+    {
+        return (*this)(rng, param_);
+    }
+
+    template <std::uniform_random_bit_generator UrngT>
+    result_type operator()(UrngT& rng, const param_type& param) const
+    {
+        using unsigned_t = std::make_unsigned_t<result_type>;
+        const uint_type_ range =
+            static_cast<unsigned_t>(static_cast<unsigned_t>(param.b()) - static_cast<unsigned_t>(param.a()));
+        const uint_type_ offset = private_::bounded_uint_<uint_type_>(rng, range);
+        return static_cast<result_type>(static_cast<unsigned_t>(static_cast<unsigned_t>(param.a()) + offset));
+    }
+
+    friend constexpr bool operator==(const uniform_int_distribution&, const uniform_int_distribution&) = default;
+
+    // Writes a and b separated by a space, as the standard library does.
+    template <class CharT, class TraitsT>
+    friend std::basic_ostream<CharT, TraitsT>& operator<<(std::basic_ostream<CharT, TraitsT>& stream,
+                                                         const uniform_int_distribution& distribution)
+    {
+        const std::ios_base::fmtflags flags = stream.flags(std::ios_base::dec | std::ios_base::left);
+        const CharT fill = stream.fill(stream.widen(' '));
+        stream << io_type_(distribution.a()) << stream.widen(' ') << io_type_(distribution.b());
+        stream.fill(fill);
+        stream.flags(flags);
+        return stream;
+    }
+
+    template <class CharT, class TraitsT>
+    friend std::basic_istream<CharT, TraitsT>& operator>>(std::basic_istream<CharT, TraitsT>& stream,
+                                                         uniform_int_distribution& distribution)
+    {
+        const std::ios_base::fmtflags flags = stream.flags(std::ios_base::dec | std::ios_base::skipws);
+        io_type_ a, b;
+        if (stream >> a >> b)
+            distribution.param(param_type(static_cast<result_type>(a), static_cast<result_type>(b)));
+        stream.flags(flags);
+        return stream;
+    }
+
+private:
+    param_type param_;
+};
+
+#endif
+
+} // namespace rand
+} // namespace arba
@@ -8,7 +8,7 @@ inline namespace arba
 namespace rand
 {
 
-inline uint32_t xorshift32(uint32_t x)
+constexpr uint32_t xorshift32(uint32_t x)
 {
     x ^= x << 13;
     x ^= x >> 17;
@@ -16,7 +16,7 @@ inline uint32_t xorshift32(uint32_t x)
     return x;
 }
 
-inline uint64_t xorshift64(uint64_t x)
+constexpr uint64_t xorshift64(uint64_t x)
 {
     x ^= x << 13;
     x ^= x >> 7;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <arba/rand/xorshift.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// xorshift is linear over GF(2): one step is a matrix T, and n steps are T^n. A matrix is stored by columns
+// (column i is the image of the i-th basis vector), so a matrix-vector product xors the columns of the set bits.
+
+template <std::unsigned_integral UintT>
+using gf2_matrix_ = std::array<UintT, std::numeric_limits<UintT>::digits>;
+
+template <std::unsigned_integral UintT>
+constexpr UintT gf2_multiply_(const gf2_matrix_<UintT>& matrix, UintT vector)
+{
+    UintT result = 0;
+    for (std::size_t i = 0; vector != 0; ++i, vector >>= 1)
+        if (vector & 1)
+            result ^= matrix[i];
+    return result;
+}
+
+template <std::unsigned_integral UintT>
+constexpr gf2_matrix_<UintT> gf2_multiply_(const gf2_matrix_<UintT>& lhs, const gf2_matrix_<UintT>& rhs)
+{
+    gf2_matrix_<UintT> result{};
+    for (std::size_t i = 0; i < result.size(); ++i)
+        result[i] = gf2_multiply_(lhs, rhs[i]);
+    return result;
+}
+
+// table[k] = T^(2^k)
+template <std::unsigned_integral UintT>
+constexpr std::array<gf2_matrix_<UintT>, std::numeric_limits<UintT>::digits>
+make_xorshift_jump_table_(UintT (*xorshift_fn)(UintT))
+{
+    std::array<gf2_matrix_<UintT>, std::numeric_limits<UintT>::digits> table{};
+    for (std::size_t i = 0; i < table[0].size(); ++i)
+        table[0][i] = xorshift_fn(UintT(1) << i);
+    for (std::size_t k = 1; k < table.size(); ++k)
+        table[k] = gf2_multiply_(table[k - 1], table[k - 1]);
+    return table;
+}
+
+inline constexpr auto xorshift32_jump_table_ = make_xorshift_jump_table_<uint32_t>(xorshift32);
+inline constexpr auto xorshift64_jump_table_ = make_xorshift_jump_table_<uint64_t>(xorshift64);
+
+template <std::unsigned_integral UintT>
+constexpr UintT xorshift_jump_(const std::array<gf2_matrix_<UintT>, std::numeric_limits<UintT>::digits>& table,
+                               UintT x, unsigned long long times)
+{
+    // The period of a non null state is 2^digits - 1.
+    times %= std::numeric_limits<UintT>::max();
+    for (std::size_t k = 0; times != 0; ++k, times >>= 1)
+        if (times & 1)
+            x = gf2_multiply_(table[k], x);
+    return x;
+}
+
+} // namespace private_
+
+// Equivalent to applying xorshift32 `times` times, in O(log(times)).
+constexpr uint32_t xorshift32_jump(uint32_t x, unsigned long long times)
+{
+    return private_::xorshift_jump_(private_::xorshift32_jump_table_, x, times);
+}
+
+// Equivalent to applying xorshift64 `times` times, in O(log(times)).
+constexpr uint64_t xorshift64_jump(uint64_t x, unsigned long long times)
+{
+    return private_::xorshift_jump_(private_::xorshift64_jump_table_, x, times);
+}
+
+} // namespace rand
+} // namespace arba
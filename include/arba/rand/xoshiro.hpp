@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+
+inline namespace arba
+{
+namespace rand
+{
+
+using xoshiro256_state = std::array<uint64_t, 4>;
+using xoroshiro128_state = std::array<uint64_t, 2>;
+
+namespace private_
+{
+
+// Next output of splitmix64, used to expand a 64-bit seed into a xoshiro state.
+constexpr uint64_t splitmix64_next_(uint64_t& state)
+{
+    uint64_t value = (state += 0x9e3779b97f4a7c15ull);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+} // namespace private_
+
+// Returns the next output of xoshiro256** and advances the state.
+constexpr uint64_t xoshiro256ss(xoshiro256_state& state)
+{
+    const uint64_t result = std::rotl(state[1] * 5, 7) * 9;
+    const uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = std::rotl(state[3], 45);
+    return result;
+}
+
+// Returns the next output of xoroshiro128+ and advances the state.
+constexpr uint64_t xoroshiro128plus(xoroshiro128_state& state)
+{
+    const uint64_t s0 = state[0];
+    uint64_t s1 = state[1];
+    const uint64_t result = s0 + s1;
+    s1 ^= s0;
+    state[0] = std::rotl(s0, 24) ^ s1 ^ (s1 << 16);
+    state[1] = std::rotl(s1, 37);
+    return result;
+}
+
+// State whose words are the successive outputs of splitmix64 from the seed, as advised by the authors of xoshiro:
+// it is never null, and close seeds give unrelated states.
+constexpr xoshiro256_state xoshiro256_seed_state(uint64_t seed)
+{
+    return { private_::splitmix64_next_(seed), private_::splitmix64_next_(seed), private_::splitmix64_next_(seed),
+             private_::splitmix64_next_(seed) };
+}
+
+constexpr xoroshiro128_state xoroshiro128_seed_state(uint64_t seed)
+{
+    return { private_::splitmix64_next_(seed), private_::splitmix64_next_(seed) };
+}
+
+} // namespace rand
+} // namespace arba
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <arba/rand/xoshiro.hpp>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// A jump of 2^k steps is the product of the state by a polynomial of the transition matrix, x^(2^k) modulo its
+// characteristic polynomial: the states met while stepping are summed over the set bits of the polynomial.
+template <class StateT, std::size_t PolynomialSize>
+constexpr StateT xoshiro_jump_(StateT state, const std::array<uint64_t, PolynomialSize>& polynomial,
+                               uint64_t (*next_fn)(StateT&))
+{
+    StateT result{};
+    for (uint64_t word : polynomial)
+    {
+        for (int bit = 0; bit < 64; ++bit, word >>= 1)
+        {
+            if (word & 1)
+                for (std::size_t i = 0; i < result.size(); ++i)
+                    result[i] ^= state[i];
+            next_fn(state);
+        }
+    }
+    return result;
+}
+
+// Characteristic polynomials of the transition matrices without their leading term x^(state bits), bit i being the
+// coefficient of x^i: x^(2^k) modulo them gives back the jump polynomials below.
+inline constexpr std::array<uint64_t, 4> xoshiro256_characteristic_polynomial_ = {
+    0x9d116f2bb0f0f001ull, 0x0280002bcefd1a5eull, 0x04b4edcf26259f85ull, 0x0003c03c3f3ecb19ull
+};
+inline constexpr std::array<uint64_t, 2> xoroshiro128_characteristic_polynomial_ = { 0x095b8f76579aa001ull,
+                                                                                     0x0008828e513b43d5ull };
+
+template <std::size_t PolynomialSize>
+constexpr std::array<uint64_t, PolynomialSize> times_x_modulo_(std::array<uint64_t, PolynomialSize> polynomial,
+                                                               const std::array<uint64_t, PolynomialSize>& modulus)
+{
+    const bool overflow = polynomial.back() >> 63;
+    for (std::size_t i = PolynomialSize - 1; i > 0; --i)
+        polynomial[i] = (polynomial[i] << 1) | (polynomial[i - 1] >> 63);
+    polynomial[0] <<= 1;
+    if (overflow)
+        for (std::size_t i = 0; i < PolynomialSize; ++i)
+            polynomial[i] ^= modulus[i];
+    return polynomial;
+}
+
+// x^times modulo the characteristic polynomial, by squarings and multiplications by x over the bits of times.
+template <std::size_t PolynomialSize>
+constexpr std::array<uint64_t, PolynomialSize> x_power_modulo_(unsigned long long times,
+                                                               const std::array<uint64_t, PolynomialSize>& modulus)
+{
+    std::array<uint64_t, PolynomialSize> result{ 1 };
+    for (int k = std::bit_width(times) - 1; k >= 0; --k)
+    {
+        // Over GF(2), p(x)^2 = p(x^2): Horner's method from the highest coefficient, with x^2 as variable.
+        std::array<uint64_t, PolynomialSize> square{};
+        for (std::size_t i = PolynomialSize * 64; i-- > 0;)
+        {
+            square = times_x_modulo_(times_x_modulo_(square, modulus), modulus);
+            square[0] ^= (result[i / 64] >> (i % 64)) & 1;
+        }
+        result = (times >> k) & 1 ? times_x_modulo_(square, modulus) : square;
+    }
+    return result;
+}
+
+// Jump of `times` steps. Up to the size of the state, stepping is cheaper than the jump, which steps as many times.
+template <class StateT, std::size_t PolynomialSize>
+constexpr StateT xoshiro_jump_(StateT state, unsigned long long times,
+                               const std::array<uint64_t, PolynomialSize>& characteristic_polynomial,
+                               uint64_t (*next_fn)(StateT&))
+{
+    if (times <= PolynomialSize * 64)
+    {
+        for (; times > 0; --times)
+            next_fn(state);
+        return state;
+    }
+    return xoshiro_jump_(state, x_power_modulo_(times, characteristic_polynomial), next_fn);
+}
+
+} // namespace private_
+
+// State of xoshiro256** 2^128 steps ahead.
+constexpr xoshiro256_state xoshiro256_jump(const xoshiro256_state& state)
+{
+    constexpr std::array<uint64_t, 4> polynomial = { 0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+                                                     0xa9582618e03fc9aaull, 0x39abdc4529b1661cull };
+    return private_::xoshiro_jump_(state, polynomial, &xoshiro256ss);
+}
+
+// State of xoshiro256** 2^192 steps ahead.
+constexpr xoshiro256_state xoshiro256_long_jump(const xoshiro256_state& state)
+{
+    constexpr std::array<uint64_t, 4> polynomial = { 0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull,
+                                                     0x77710069854ee241ull, 0x39109bb02acbe635ull };
+    return private_::xoshiro_jump_(state, polynomial, &xoshiro256ss);
+}
+
+// State of xoshiro256** `times` steps ahead, in O(log(times)).
+constexpr xoshiro256_state xoshiro256_jump(const xoshiro256_state& state, unsigned long long times)
+{
+    return private_::xoshiro_jump_(state, times, private_::xoshiro256_characteristic_polynomial_, &xoshiro256ss);
+}
+
+// State of xoroshiro128+ 2^64 steps ahead.
+constexpr xoroshiro128_state xoroshiro128_jump(const xoroshiro128_state& state)
+{
+    constexpr std::array<uint64_t, 2> polynomial = { 0xdf900294d8f554a5ull, 0x170865df4b3201fcull };
+    return private_::xoshiro_jump_(state, polynomial, &xoroshiro128plus);
+}
+
+// State of xoroshiro128+ 2^96 steps ahead.
+constexpr xoroshiro128_state xoroshiro128_long_jump(const xoroshiro128_state& state)
+{
+    constexpr std::array<uint64_t, 2> polynomial = { 0xd2a98b26625eee7bull, 0xdddf9b1090aa7ac1ull };
+    return private_::xoshiro_jump_(state, polynomial, &xoroshiro128plus);
+}
+
+// State of xoroshiro128+ `times` steps ahead, in O(log(times)).
+constexpr xoroshiro128_state xoroshiro128_jump(const xoroshiro128_state& state, unsigned long long times)
+{
+    return private_::xoshiro_jump_(state, times, private_::xoroshiro128_characteristic_polynomial_,
+                                   &xoroshiro128plus);
+}
+
+} // namespace rand
+} // namespace arba
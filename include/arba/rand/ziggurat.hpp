@@ -0,0 +1,283 @@
+#pragma once
+
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
+#include <arba/core/container/span.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+
+inline namespace arba
+{
+namespace rand
+{
+namespace private_
+{
+
+// constexpr versions of exp, log and sqrt, precise to a few ulps: they are only used to build the tables.
+
+inline constexpr double ln2_hi_ = 6.93147180369123816490e-01;
+inline constexpr double ln2_lo_ = 1.90821492927058770002e-10;
+
+constexpr double constexpr_exp_(double x)
+{
+    const long long k = static_cast<long long>(x / (ln2_hi_ + ln2_lo_) + (x < 0 ? -0.5 : 0.5));
+    const double r = (x - k * ln2_hi_) - k * ln2_lo_;
+    double sum = 1;
+    double term = 1;
+    for (int n = 1; n < 30; ++n)
+    {
+        term *= r / n;
+        sum += term;
+    }
+    for (long long i = 0; i < k; ++i)
+        sum *= 2;
+    for (long long i = 0; i > k; --i)
+        sum /= 2;
+    return sum;
+}
+
+constexpr double constexpr_log_(double x)
+{
+    long long e = 0;
+    for (; x > 1.4142135623730951; ++e)
+        x /= 2;
+    for (; x < 0.7071067811865476; --e)
+        x *= 2;
+    const double z = (x - 1) / (x + 1);
+    const double z2 = z * z;
+    double sum = 0;
+    double term = z;
+    for (int n = 1; n < 80; n += 2)
+    {
+        sum += term / n;
+        term *= z2;
+    }
+    return 2 * sum + e * ln2_lo_ + e * ln2_hi_;
+}
+
+constexpr double constexpr_sqrt_(double x)
+{
+    if (x <= 0)
+        return 0;
+    double root = x < 1 ? 1 : x;
+    for (int i = 0; i < 1100; ++i)
+    {
+        const double next_root = (root + x / root) / 2;
+        if (next_root == root)
+            break;
+        root = next_root;
+    }
+    return root;
+}
+
+inline constexpr std::size_t ziggurat_nb_layers_ = 256;
+
+// Layer i spans [0, x[i]] horizontally and [f[i], f[i + 1]] vertically. x[0] is the width of a virtual rectangle
+// of area V standing for the base layer (the rectangle [0, R] plus the tail), x[1] = R and x[256] = 0.
+struct ziggurat_tables_
+{
+    std::array<double, ziggurat_nb_layers_ + 1> x;
+    std::array<double, ziggurat_nb_layers_ + 1> f;
+};
+
+// Marsaglia and Tsang construction of the layers of equal area v, from the start r of the tail.
+template <class PdfFunctionT, class InversePdfFunctionT>
+constexpr ziggurat_tables_ make_ziggurat_tables_(double r, double v, PdfFunctionT pdf,
+                                                 InversePdfFunctionT inverse_pdf)
+{
+    ziggurat_tables_ tables{};
+    tables.x[0] = v / pdf(r);
+    tables.x[1] = r;
+    for (std::size_t i = 2; i < ziggurat_nb_layers_; ++i)
+        tables.x[i] = inverse_pdf(v / tables.x[i - 1] + pdf(tables.x[i - 1]));
+    tables.x[ziggurat_nb_layers_] = 0;
+    for (std::size_t i = 0; i <= ziggurat_nb_layers_; ++i)
+        tables.f[i] = pdf(tables.x[i]);
+    tables.f[ziggurat_nb_layers_] = 1;
+    return tables;
+}
+
+// Uniform real in [0, 1).
+inline double closed_open_01_(uint64_t bits)
+{
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+// Uniform real in (0, 1).
+inline double open_01_(uint64_t bits)
+{
+    return (static_cast<double>(bits >> 11) + 0.5) * 0x1.0p-53;
+}
+
+template <std::uniform_random_bit_generator UrngT>
+inline uint64_t draw_u64_(UrngT& rng)
+{
+    uniform_int_distribution<uint64_t> distribution;
+    return distribution(rng);
+}
+
+// Unnormalized standard normal density exp(-x^2 / 2), with the 256 layers of Marsaglia and Tsang.
+struct ziggurat_normal_
+{
+    static constexpr bool symmetric = true;
+    static constexpr double r = 3.654152885361008796;
+    static constexpr double v = 0.00492867323399;
+
+    static constexpr double pdf(double x)
+    {
+        if (std::is_constant_evaluated())
+            return constexpr_exp_(-x * x / 2);
+        return std::exp(-x * x / 2);
+    }
+
+    static constexpr double inverse_pdf(double y) { return constexpr_sqrt_(-2 * constexpr_log_(y)); }
+
+    // Marsaglia's tail sampling beyond r, on the side of the candidate.
+    template <std::uniform_random_bit_generator UrngT>
+    static double tail(double candidate, UrngT& rng)
+    {
+        double x;
+        double y;
+        do
+        {
+            x = std::log(open_01_(draw_u64_(rng))) / r;
+            y = std::log(open_01_(draw_u64_(rng)));
+        } while (-2 * y < x * x);
+        return candidate < 0 ? x - r : r - x;
+    }
+};
+
+// Unnormalized standard exponential density exp(-x), with the 256 layers of Marsaglia and Tsang.
+struct ziggurat_exponential_
+{
+    static constexpr bool symmetric = false;
+    static constexpr double r = 7.697117470131050077;
+    static constexpr double v = 0.0039496598225815571993;
+
+    static constexpr double pdf(double x)
+    {
+        if (std::is_constant_evaluated())
+            return constexpr_exp_(-x);
+        return std::exp(-x);
+    }
+
+    static constexpr double inverse_pdf(double y) { return -constexpr_log_(y); }
+
+    // The exponential distribution is memoryless: its tail beyond r is r plus an exponential value.
+    template <std::uniform_random_bit_generator UrngT>
+    static double tail(double, UrngT& rng)
+    {
+        return r - std::log(open_01_(draw_u64_(rng)));
+    }
+};
+
+template <class ZigguratT>
+inline constexpr ziggurat_tables_ ziggurat_tables_v_ =
+    make_ziggurat_tables_(ZigguratT::r, ZigguratT::v, ZigguratT::pdf, ZigguratT::inverse_pdf);
+
+inline unsigned ziggurat_layer_(uint64_t bits)
+{
+    return static_cast<unsigned>(bits & (ziggurat_nb_layers_ - 1));
+}
+
+// Candidate of the layer: the 52 high bits give a uniform value in [-1, 1) (or [0, 1)) scaled to the layer width.
+template <class ZigguratT>
+inline double ziggurat_candidate_(uint64_t bits, unsigned layer)
+{
+    constexpr uint64_t exponent_bits = std::bit_cast<uint64_t>(ZigguratT::symmetric ? 2. : 1.);
+    constexpr double offset = ZigguratT::symmetric ? 3. : 1.;
+    const double u = std::bit_cast<double>((bits >> 12) | exponent_bits) - offset;
+    return u * ziggurat_tables_v_<ZigguratT>.x[layer];
+}
+
+// True when the candidate lies in the rectangle fully under the density (about 99% of the draws).
+template <class ZigguratT>
+inline bool ziggurat_accepts_(double candidate, unsigned layer)
+{
+    return (ZigguratT::symmetric ? std::abs(candidate) : candidate) < ziggurat_tables_v_<ZigguratT>.x[layer + 1];
+}
+
+template <class ZigguratT, std::uniform_random_bit_generator UrngT>
+double ziggurat_sample_(UrngT& rng);
+
+// Rare case of a candidate outside its rectangle: the tail for the base layer, the wedge test otherwise.
+template <class ZigguratT, std::uniform_random_bit_generator UrngT>
+[[gnu::noinline]] double ziggurat_resolve_(double candidate, unsigned layer, UrngT& rng)
+{
+    constexpr const ziggurat_tables_& tables = ziggurat_tables_v_<ZigguratT>;
+    if (layer == 0)
+        return ZigguratT::tail(candidate, rng);
+    const double y = tables.f[layer] + (tables.f[layer + 1] - tables.f[layer]) * closed_open_01_(draw_u64_(rng));
+    if (y < ZigguratT::pdf(candidate))
+        return candidate;
+    return ziggurat_sample_<ZigguratT>(rng);
+}
+
+template <class ZigguratT, std::uniform_random_bit_generator UrngT>
+double ziggurat_sample_(UrngT& rng)
+{
+    const uint64_t bits = draw_u64_(rng);
+    const unsigned layer = ziggurat_layer_(bits);
+    const double candidate = ziggurat_candidate_<ZigguratT>(bits, layer);
+    if (ziggurat_accepts_<ZigguratT>(candidate, layer)) [[likely]]
+        return candidate;
+    return ziggurat_resolve_<ZigguratT>(candidate, layer, rng);
+}
+
+inline constexpr std::size_t ziggurat_block_size_ = 256;
+
+// Fills the reals with shift + scale * sample. The raw words are generated in bulk by the range engine, then each
+// block goes through a branchless pass writing the candidates in place and appending the rejected ones (their index
+// and layer) to a compact list, which is resolved afterwards with words drawn from a small buffered source.
+template <class ZigguratT, RandomNumberRangeGenerator RnrgT>
+std::span<double> ziggurat_fill_(std::span<double> reals, RnrgT& rnrg, double shift, double scale,
+                                 cppx::ExecutionPolicy auto execution_policy)
+{
+    const std::span bytes = std::as_writable_bytes(reals);
+    rnrg_fill_(rnrg, bytes, execution_policy);
+    const std::span words = core::as_writable_span<uint64_t>(bytes);
+    rnrg_word_source_<uint64_t, RnrgT> word_source(rnrg);
+
+    std::array<uint32_t, ziggurat_block_size_> rejected_entries;
+    for (std::size_t offset = 0; offset < words.size(); offset += ziggurat_block_size_)
+    {
+        const std::size_t count = std::min(ziggurat_block_size_, words.size() - offset);
+        uint64_t* block_words = words.data() + offset;
+
+        std::size_t nb_rejected = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const unsigned layer = ziggurat_layer_(block_words[i]);
+            const double candidate = ziggurat_candidate_<ZigguratT>(block_words[i], layer);
+            block_words[i] = std::bit_cast<uint64_t>(candidate);
+            rejected_entries[nb_rejected] = static_cast<uint32_t>(i << 8) | layer;
+            nb_rejected += !ziggurat_accepts_<ZigguratT>(candidate, layer);
+        }
+
+        for (std::size_t k = 0; k < nb_rejected; ++k)
+        {
+            const std::size_t i = rejected_entries[k] >> 8;
+            const unsigned layer = rejected_entries[k] & (ziggurat_nb_layers_ - 1);
+            const double candidate = std::bit_cast<double>(block_words[i]);
+            block_words[i] = std::bit_cast<uint64_t>(ziggurat_resolve_<ZigguratT>(candidate, layer, word_source));
+        }
+
+        if (shift != 0 || scale != 1)
+            for (std::size_t i = 0; i < count; ++i)
+                block_words[i] = std::bit_cast<uint64_t>(shift + scale * std::bit_cast<double>(block_words[i]));
+    }
+    return reals;
+}
+
+} // namespace private_
+} // namespace rand
+} // namespace arba
@@ -1,4 +1,5 @@
 #include <arba/rand/rand.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
 
 inline namespace arba
 {
@@ -7,12 +8,30 @@ namespace rand
 namespace private_
 {
 
-rand_int_engine_type_& rand_int_engine_()
+uint64_t random_device_seed_()
 {
-    static thread_local rand_int_engine_type_ instance(std::random_device{}());
-    return instance;
+    std::random_device device;
+    return (uint64_t(device()) << 32) ^ device();
 }
 
+#if defined(ARBA_RAND_GLOBAL_ENGINE_BUFFERED)
+
+uint64_t fill_global_block_(uint64_t (&block)[global_block_size_], uint64_t state)
+{
+    xorshift64_range_engine<> rnrg(state);
+    rnrg(std::span<uint64_t>(block), cppx::endianness_specific);
+    return rnrg.seed();
+}
+
+#elif !defined(ARBA_RAND_GLOBAL_ENGINE_MT19937_64)
+
+uint64_t seed_global_xorshift64_()
+{
+    return mix_seed_(random_device_seed_());
+}
+
+#endif
+
 } // namespace private_
 } // namespace rand
 } // namespace arba
@@ -0,0 +1,99 @@
+#include <arba/rand/alias_table.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+void check_frequencies_(const std::vector<double>& weights, std::span<const rand::alias_table::index_type> samples)
+{
+    const double sum = std::reduce(weights.cbegin(), weights.cend());
+    std::vector<std::size_t> counters(weights.size(), 0);
+    for (auto index : samples)
+        ++counters.at(index);
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        const double expected = weights[i] / sum;
+        const double actual = double(counters[i]) / samples.size();
+        ASSERT_NEAR(actual, expected, 5 * std::sqrt(expected * (1 - expected) / samples.size()) + 1e-9) << "i = " << i;
+    }
+}
+
+} // namespace
+
+TEST(alias_table_tests, constructor__weights__probabilities_ok)
+{
+    const std::vector<double> weights = { 1., 0., 3., 0.5, 10., 2.5, 0., 7. };
+    const double sum = std::reduce(weights.cbegin(), weights.cend());
+    const rand::alias_table table(weights);
+    ASSERT_EQ(table.size(), weights.size());
+    for (std::size_t i = 0; i < weights.size(); ++i)
+        EXPECT_NEAR(table.probability(i), weights[i] / sum, 1e-9) << "i = " << i;
+}
+
+TEST(alias_table_tests, constructor__initializer_list__ok)
+{
+    const rand::alias_table table = { 1., 1., 2. };
+    ASSERT_EQ(table.size(), 3);
+    EXPECT_NEAR(table.probability(2), 0.5, 1e-9);
+}
+
+TEST(alias_table_tests, constructor__seq_and_par__same_table)
+{
+    std::vector<double> weights(100'000);
+    rand::xorshift64_engine rng(42);
+    std::ranges::generate(weights, [&] { return double(rng() % 1000); });
+    const rand::alias_table seq_table(weights, std::execution::seq);
+    const rand::alias_table par_table(weights, std::execution::par);
+    ASSERT_TRUE(std::ranges::equal(seq_table.entries(), par_table.entries(),
+                                   [](const auto& lhs, const auto& rhs)
+                                   { return lhs.threshold == rhs.threshold && lhs.alias == rhs.alias; }));
+}
+
+TEST(alias_table_tests, operator_call__urng__frequencies_ok)
+{
+    const std::vector<double> weights = { 1., 0., 3., 0.5, 10., 2.5, 0., 7. };
+    const rand::alias_table table(weights);
+    rand::xorshift64_engine rng(42);
+    std::vector<rand::alias_table::index_type> samples(1'000'000);
+    std::ranges::generate(samples, [&] { return table(rng); });
+    check_frequencies_(weights, samples);
+}
+
+TEST(alias_table_tests, operator_call__range_engine__frequencies_ok)
+{
+    std::vector<double> weights(1000);
+    for (std::size_t i = 0; i < weights.size(); ++i)
+        weights[i] = 1. / (i + 1);
+    const rand::alias_table table(weights);
+    rand::xorshift64_range_engine<> rnrg(42);
+    std::vector<rand::alias_table::index_type> samples(2'000'003);
+    table(std::span(samples), rnrg);
+    check_frequencies_(weights, samples);
+}
+
+TEST(alias_table_tests, operator_call__range_engine__same_as_single_samples)
+{
+    const rand::alias_table table = { 5., 1., 1., 0., 3. };
+    const std::size_t size = 3 * rand::alias_table::chunk_size + 7;
+    std::vector<rand::alias_table::index_type> samples(size);
+    rand::xoron64_range_engine<> rnrg(42);
+    table(std::span(samples), rnrg);
+
+    std::vector<uint64_t> words(size);
+    rand::xoron64_range_engine<> words_rnrg(42);
+    for (std::size_t offset = 0; offset < size; offset += rand::alias_table::chunk_size)
+        words_rnrg(std::span(words).subspan(offset, std::min(rand::alias_table::chunk_size, size - offset)),
+                   cppx::endianness_specific);
+    for (std::size_t i = 0; i < size; ++i)
+        ASSERT_EQ(samples[i], table.sample(words[i]));
+}
@@ -0,0 +1,47 @@
+#include <arba/rand/chacha.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+// Keystreams of the all-zero key and nonce (Bernstein's reference implementation), and test vector 2.3.2 of RFC 8439.
+
+static_assert(rand::chacha({}, 0, 0)[0] == 0xade0b876u);
+
+TEST(chacha_tests, chacha8__zero_key__ok)
+{
+    const rand::chacha_block expected = { 0x2fef003eu, 0xd6405f89u, 0xe8b85b7fu, 0xa1a5091fu, 0xc30e842cu, 0x3b7f9aceu,
+                                          0x88e11b18u, 0x1e1a71efu, 0x72e14c98u, 0x416f21b9u, 0x6753449fu, 0x19566d45u,
+                                          0xa3424a31u, 0x01b086dau, 0xb8fd7b38u, 0x42fe0c0eu };
+    EXPECT_EQ(rand::chacha<8>({}, 0, 0), expected);
+}
+
+TEST(chacha_tests, chacha12__zero_key__ok)
+{
+    const rand::chacha_block expected = { 0x6a9af49bu, 0x53f95507u, 0x12ce1f81u, 0xd583265fu, 0xbbc32904u, 0x1474e049u,
+                                          0xa589007eu, 0x5f15ae2eu, 0x79f86405u, 0xc0e37ad2u, 0x3428e82cu, 0x798cfaacu,
+                                          0x2c9f623au, 0x1969dea0u, 0x2fe80b61u, 0xbe261341u };
+    EXPECT_EQ(rand::chacha<12>({}, 0, 0), expected);
+}
+
+TEST(chacha_tests, chacha20__zero_key__ok)
+{
+    const rand::chacha_block expected = { 0xade0b876u, 0x903df1a0u, 0xe56a5d40u, 0x28bd8653u, 0xb819d2bdu, 0x1aed8da0u,
+                                          0xccef36a8u, 0xc70d778bu, 0x7c5941dau, 0x8d485751u, 0x3fe02477u, 0x374ad8b8u,
+                                          0xf4b8436au, 0x1ca11815u, 0x69b687c3u, 0x8665eeb2u };
+    EXPECT_EQ(rand::chacha({}, 0, 0), expected);
+}
+
+// RFC 8439 uses a 32-bit counter (1) and a 96-bit nonce (00:00:00:09:00:00:00:4a:00:00:00:00), which are the 64-bit
+// counter 0x09000000'00000001 and the 64-bit nonce 0x4a000000 of the original layout.
+TEST(chacha_tests, chacha20__rfc8439_block__ok)
+{
+    rand::chacha_key key;
+    for (uint32_t i = 0; i < key.size(); ++i)
+        key[i] = (4 * i) | ((4 * i + 1) << 8) | ((4 * i + 2) << 16) | ((4 * i + 3) << 24);
+    const rand::chacha_block expected = { 0xe4e7f110u, 0x15593bd1u, 0x1fdd0f50u, 0xc47120a3u, 0xc7f4d1c7u, 0x0368c033u,
+                                          0x9aaa2204u, 0x4e6cd4c3u, 0x466482d2u, 0x09aa9f07u, 0x05d7c214u, 0xa2028bd9u,
+                                          0xd19c12b5u, 0xb94e16deu, 0xe883d0cbu, 0x4e3c50a2u };
+    EXPECT_EQ(rand::chacha(key, 0x09000000'00000001ull, 0x4a000000ull), expected);
+}
@@ -0,0 +1,106 @@
+#include <arba/rand/algorithm/count_distinct.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+template <class IntType>
+std::size_t sort_unique_count_(std::vector<IntType> ints)
+{
+    std::ranges::sort(ints);
+    return std::distance(ints.begin(), std::unique(ints.begin(), ints.end()));
+}
+
+template <class IntType>
+std::vector<IntType> random_ints_(std::size_t nb_ints, uint64_t modulo)
+{
+    std::mt19937_64 rng(42);
+    std::vector<IntType> ints(nb_ints);
+    for (IntType& value : ints)
+        value = IntType(rng() % modulo);
+    return ints;
+}
+
+TEST(count_distinct_tests, count_distinct__empty__zero)
+{
+    const std::vector<uint64_t> ints;
+    EXPECT_EQ(rand::count_distinct(std::span<const uint64_t>(ints)), 0);
+    EXPECT_EQ(rand::count_distinct(std::span<const uint64_t>(ints), std::execution::par), 0);
+}
+
+TEST(count_distinct_tests, count_distinct__zeros__one)
+{
+    const std::vector<uint32_t> ints(100'000, 0);
+    EXPECT_EQ(rand::count_distinct(std::span<const uint32_t>(ints)), 1);
+}
+
+TEST(count_distinct_tests, count_distinct__uint64_duplicates__same_as_sort_unique)
+{
+    for (const uint64_t modulo : { 10ull, 1'000'000ull, ~0ull })
+    {
+        const std::vector ints = random_ints_<uint64_t>(3'000'007, modulo);
+        const std::size_t expected_count = sort_unique_count_(ints);
+        EXPECT_EQ(rand::count_distinct(std::span<const uint64_t>(ints)), expected_count);
+        EXPECT_EQ(rand::count_distinct(std::span<const uint64_t>(ints), std::execution::par), expected_count);
+    }
+}
+
+TEST(count_distinct_tests, count_distinct__int32_duplicates__same_as_sort_unique)
+{
+    for (const uint64_t modulo : { 1'000ull, 1'000'000ull, 1ull << 32 })
+    {
+        const std::vector ints = random_ints_<int32_t>(2'500'001, modulo);
+        const std::size_t expected_count = sort_unique_count_(ints);
+        EXPECT_EQ(rand::count_distinct(std::span<const int32_t>(ints)), expected_count);
+        EXPECT_EQ(rand::count_distinct(std::span<const int32_t>(ints), std::execution::par), expected_count);
+    }
+}
+
+TEST(count_distinct_tests, count_distinct__structured_ints__ok)
+{
+    std::vector<uint64_t> ints;
+    for (uint64_t i = 0; i < 100'000; ++i)
+        ints.push_back(i << 40);
+    ints.insert(ints.end(), ints.begin(), ints.end());
+    EXPECT_EQ(rand::count_distinct(std::span<const uint64_t>(ints), std::execution::par), 100'000);
+}
+
+TEST(count_distinct_tests, count_distinct__small_ints__same_as_sort_unique)
+{
+    const std::vector bytes = random_ints_<uint8_t>(1'000, 200);
+    EXPECT_EQ(rand::count_distinct(std::span<const uint8_t>(bytes)), sort_unique_count_(bytes));
+    const std::vector shorts = random_ints_<int16_t>(100'000, 50'000);
+    EXPECT_EQ(rand::count_distinct(std::span<const int16_t>(shorts)), sort_unique_count_(shorts));
+}
+
+TEST(count_distinct_tests, count_distinct__scratch_reused__same_as_sort_unique)
+{
+    std::vector<rand::distinct_mix_t<uint64_t>> scratch(1'000'000);
+    for (const uint64_t modulo : { 100ull, 500'000ull })
+    {
+        const std::vector ints = random_ints_<uint64_t>(1'000'000, modulo);
+        const std::vector ints_copy = ints;
+        EXPECT_EQ(rand::count_distinct(std::span<const uint64_t>(ints), std::span(scratch), std::execution::seq),
+                  sort_unique_count_(ints));
+        EXPECT_EQ(ints, ints_copy);
+    }
+}
+
+TEST(count_distinct_tests, approximate_count_distinct__uint64_duplicates__near)
+{
+    const std::vector ints = random_ints_<uint64_t>(3'000'007, 1'000'000);
+    const double expected_count = double(sort_unique_count_(ints));
+    EXPECT_NEAR(double(rand::approximate_count_distinct(std::span<const uint64_t>(ints))), expected_count,
+                expected_count * 0.015);
+    EXPECT_EQ(rand::approximate_count_distinct(std::span<const uint64_t>(ints), std::execution::par),
+              rand::approximate_count_distinct(std::span<const uint64_t>(ints)));
+}
+
+TEST(count_distinct_tests, approximate_count_distinct__uint32_small__near)
+{
+    const std::vector ints = random_ints_<uint32_t>(100'000, 1'000);
+    EXPECT_NEAR(double(rand::approximate_count_distinct(std::span<const uint32_t>(ints))), 1'000., 10.);
+}
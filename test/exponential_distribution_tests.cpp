@@ -0,0 +1,68 @@
+#include <arba/rand/algorithm/rand_exponentials.hpp>
+#include <arba/rand/exponential_distribution.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+// Compares the empirical distribution function with the expected one at several points, including the tail.
+void check_exponentials_(std::vector<double> values, double lambda)
+{
+    const double size = values.size();
+    ASSERT_TRUE(std::ranges::all_of(values, [](double value) { return value >= 0; }));
+    EXPECT_NEAR(std::reduce(values.cbegin(), values.cend()) / size, 1 / lambda, 0.01 / lambda);
+
+    std::ranges::sort(values);
+    for (double x : { 0.01, 0.1, 0.5, 1., 2., 5., 7.6, 7.8, 9. })
+    {
+        const double expected = -std::expm1(-x);
+        const double actual = (std::ranges::upper_bound(values, x / lambda) - values.begin()) / size;
+        EXPECT_NEAR(actual, expected, 5 * std::sqrt(expected * (1 - expected) / size) + 1e-6) << "x = " << x;
+    }
+}
+
+} // namespace
+
+TEST(exponential_distribution_tests, constructor__ok)
+{
+    rand::exponential_distribution<> distribution;
+    EXPECT_EQ(distribution.lambda(), 1.);
+    rand::exponential_distribution<float> float_distribution(2.f);
+    EXPECT_EQ(float_distribution.lambda(), 2.f);
+}
+
+TEST(exponential_distribution_tests, operator_call__xorshift64_engine__exponential)
+{
+    rand::xorshift64_engine rng(42);
+    rand::exponential_distribution<> distribution(4.);
+    std::vector<double> values(1'000'000);
+    std::ranges::generate(values, [&] { return distribution(rng); });
+    check_exponentials_(std::move(values), 4.);
+}
+
+TEST(exponential_distribution_tests, rand_exponentials__xorshift64_range_engine__exponential)
+{
+    rand::xorshift64_range_engine<> rnrg(42);
+    std::vector<double> values(1'000'001);
+    rand::rand_exponentials(std::span(values), 0.5, rnrg);
+    check_exponentials_(std::move(values), 0.5);
+}
+
+TEST(exponential_distribution_tests, rand_exponentials__seq_and_par__same_values)
+{
+    const std::size_t size = 3 * rand::xorshift64_range_engine<>::parallel_block_size + 5;
+    std::vector<double> seq_values(size), par_values(size);
+    rand::xorshift64_range_engine<> seq_rnrg(42), par_rnrg(42);
+    rand::rand_exponentials(std::span(seq_values), seq_rnrg, std::execution::seq);
+    rand::rand_exponentials(std::span(par_values), par_rnrg, std::execution::par);
+    ASSERT_EQ(seq_values, par_values);
+}
@@ -0,0 +1,62 @@
+#include <arba/rand/hyperloglog.hpp>
+#include <arba/rand/rng/splitmix64_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+static_assert(rand::hyperloglog<>::nb_registers == 65'536);
+
+TEST(hyperloglog_tests, estimate__empty__zero)
+{
+    const rand::hyperloglog<> sketch;
+    EXPECT_EQ(sketch.estimate(), 0.);
+}
+
+TEST(hyperloglog_tests, estimate__small_cardinality__near)
+{
+    rand::splitmix64_engine rng(42);
+    rand::hyperloglog<> sketch;
+    for (unsigned i = 0; i < 1'000; ++i)
+        sketch.insert(rng());
+    EXPECT_NEAR(sketch.estimate(), 1'000., 10.);
+}
+
+TEST(hyperloglog_tests, estimate__large_cardinality__near)
+{
+    rand::splitmix64_engine rng(42);
+    rand::hyperloglog<> sketch;
+    for (unsigned i = 0; i < 5'000'000; ++i)
+        sketch.insert(rng());
+    EXPECT_NEAR(sketch.estimate(), 5'000'000., 5'000'000. * 0.015);
+}
+
+TEST(hyperloglog_tests, insert__duplicates__not_counted)
+{
+    rand::hyperloglog<12> sketch;
+    for (unsigned times = 0; times < 10; ++times)
+    {
+        rand::splitmix64_engine rng(42);
+        for (unsigned i = 0; i < 100; ++i)
+            sketch.insert(rng());
+    }
+    EXPECT_NEAR(sketch.estimate(), 100., 2.);
+}
+
+TEST(hyperloglog_tests, merge__halves__same_as_whole)
+{
+    rand::splitmix64_engine rng(42);
+    rand::hyperloglog<> whole_sketch;
+    rand::hyperloglog<> first_sketch;
+    rand::hyperloglog<> second_sketch;
+    for (unsigned i = 0; i < 200'000; ++i)
+    {
+        const uint64_t hash = rng();
+        whole_sketch.insert(hash);
+        (i % 2 == 0 ? first_sketch : second_sketch).insert(hash);
+    }
+    first_sketch.merge(second_sketch);
+    EXPECT_EQ(first_sketch.estimate(), whole_sketch.estimate());
+    first_sketch.clear();
+    EXPECT_EQ(first_sketch.estimate(), 0.);
+}
@@ -0,0 +1,100 @@
+#include <arba/rand/algorithm/rand_normals.hpp>
+#include <arba/rand/normal_distribution.hpp>
+#include <arba/rand/rng/urng.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+double standard_normal_cdf(double x)
+{
+    return std::erfc(-x / std::sqrt(2.)) / 2;
+}
+
+// Compares the empirical distribution function with the expected one at several points, including the tail.
+void check_normals_(std::vector<double> values, double mean, double stddev)
+{
+    const double size = values.size();
+    const double average = std::reduce(values.cbegin(), values.cend()) / size;
+    const double variance =
+        std::transform_reduce(values.cbegin(), values.cend(), 0., std::plus<>(),
+                              [=](double value) { return (value - average) * (value - average); })
+        / size;
+    EXPECT_NEAR(average, mean, 0.01 * stddev);
+    EXPECT_NEAR(std::sqrt(variance), stddev, 0.01 * stddev);
+
+    std::ranges::sort(values);
+    for (double x : { -4., -3.7, -3., -2., -1., -0.5, 0., 0.3, 1., 2.5, 3.6, 3.7, 4. })
+    {
+        const double expected = standard_normal_cdf(x);
+        const double actual = (std::ranges::upper_bound(values, mean + x * stddev) - values.begin()) / size;
+        EXPECT_NEAR(actual, expected, 5 * std::sqrt(expected * (1 - expected) / size) + 1e-6) << "x = " << x;
+    }
+}
+
+} // namespace
+
+TEST(normal_distribution_tests, constructor__ok)
+{
+    rand::normal_distribution<> distribution;
+    EXPECT_EQ(distribution.mean(), 0.);
+    EXPECT_EQ(distribution.stddev(), 1.);
+    rand::normal_distribution<float> float_distribution(2.f, 3.f);
+    EXPECT_EQ(float_distribution.mean(), 2.f);
+    EXPECT_EQ(float_distribution.stddev(), 3.f);
+}
+
+TEST(normal_distribution_tests, operator_call__xorshift64_engine__normal)
+{
+    rand::xorshift64_engine rng(42);
+    rand::normal_distribution<> distribution(5., 2.);
+    std::vector<double> values(1'000'000);
+    std::ranges::generate(values, [&] { return distribution(rng); });
+    check_normals_(std::move(values), 5., 2.);
+}
+
+TEST(normal_distribution_tests, operator_call__uniform_engine__normal)
+{
+    rand::urng_u64<> rng(42);
+    rand::normal_distribution<> distribution;
+    std::vector<double> values(1'000'000);
+    std::ranges::generate(values, [&] { return distribution(rng); });
+    check_normals_(std::move(values), 0., 1.);
+}
+
+TEST(normal_distribution_tests, rand_normals__xorshift64_range_engine__normal)
+{
+    rand::xorshift64_range_engine<> rnrg(42);
+    std::vector<double> values(1'000'001);
+    rand::rand_normals(std::span(values), -1., 0.5, rnrg);
+    check_normals_(std::move(values), -1., 0.5);
+}
+
+TEST(normal_distribution_tests, rand_normals__xoron64_range_engine__normal)
+{
+    rand::xoron64_range_engine<> rnrg(42);
+    std::vector<double> values(1'000'000);
+    rand::rand_normals(std::span(values), rnrg);
+    check_normals_(std::move(values), 0., 1.);
+}
+
+TEST(normal_distribution_tests, rand_normals__seq_and_par__same_values)
+{
+    const std::size_t size = 3 * rand::xorshift64_range_engine<>::parallel_block_size + 5;
+    std::vector<double> seq_values(size), par_values(size);
+    rand::xorshift64_range_engine<> seq_rnrg(42), par_rnrg(42);
+    rand::rand_normals(std::span(seq_values), seq_rnrg, std::execution::seq);
+    rand::rand_normals(std::span(par_values), par_rnrg, std::execution::par);
+    ASSERT_EQ(seq_values, par_values);
+}
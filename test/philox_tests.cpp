@@ -0,0 +1,27 @@
+#include <arba/rand/philox.hpp>
+
+#include <gtest/gtest.h>
+
+// Known-answer vectors of Random123 (kat_vectors, philox4x32 10 rounds).
+
+static_assert(rand::philox4x32({ 0, 0, 0, 0 }, { 0, 0 })[0] == 0x6627e8d5u);
+
+TEST(philox_tests, philox4x32__kat_zeros__ok)
+{
+    const rand::philox4x32_counter expected = { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u };
+    EXPECT_EQ(rand::philox4x32({ 0, 0, 0, 0 }, { 0, 0 }), expected);
+}
+
+TEST(philox_tests, philox4x32__kat_ones__ok)
+{
+    const rand::philox4x32_counter expected = { 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu };
+    EXPECT_EQ(rand::philox4x32({ 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu }, { 0xffffffffu, 0xffffffffu }),
+              expected);
+}
+
+TEST(philox_tests, philox4x32__kat_pi__ok)
+{
+    const rand::philox4x32_counter expected = { 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u };
+    EXPECT_EQ(rand::philox4x32({ 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u }, { 0xa4093822u, 0x299f31d0u }),
+              expected);
+}
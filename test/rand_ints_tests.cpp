@@ -0,0 +1,102 @@
+#include <arba/rand/algorithm/rand_ints.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+template <std::integral IntType>
+void check_bounds_(const std::vector<IntType>& ints, IntType min, IntType max)
+{
+    ASSERT_TRUE(std::ranges::all_of(ints, [=](IntType value) { return min <= value && value <= max; }));
+    using uint_t = std::make_unsigned_t<IntType>;
+    if (static_cast<uint_t>(static_cast<uint_t>(max) - static_cast<uint_t>(min)) < 1'000)
+    {
+        ASSERT_EQ(std::ranges::min(ints), min);
+        ASSERT_EQ(std::ranges::max(ints), max);
+    }
+}
+
+template <std::integral IntType, class RngT>
+void check_rand_ints_(RngT& rng, IntType min, IntType max, std::size_t size)
+{
+    std::vector<IntType> ints(size);
+    rand::rand_ints(std::span(ints), min, max, rng);
+    check_bounds_(ints, min, max);
+}
+
+TEST(rand_ints_tests, rand_ints__urng__ok)
+{
+    rand::xorshift64_engine rng(42);
+    check_rand_ints_<int8_t>(rng, -100, 27, 10'000);
+    check_rand_ints_<uint32_t>(rng, 7, 1'007, 100'000);
+    check_rand_ints_<int64_t>(rng, -5, 5, 10'000);
+}
+
+TEST(rand_ints_tests, rand_ints__xorshift64_range_engine__ok)
+{
+    rand::xorshift64_range_engine<> rnrg(42);
+    check_rand_ints_<int8_t>(rnrg, -100, 27, 10'000);
+    check_rand_ints_<uint8_t>(rnrg, 0, 255, 10'000);
+    check_rand_ints_<int16_t>(rnrg, -1000, -10, 100'000);
+    check_rand_ints_<uint16_t>(rnrg, 1, 6, 10'001);
+    check_rand_ints_<int32_t>(rnrg, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 10'000);
+    check_rand_ints_<uint32_t>(rnrg, 0, 2'999'999'999u, 10'003);
+    check_rand_ints_<int64_t>(rnrg, -5'000'000'000'000ll, -4'999'999'999'990ll, 10'000);
+    check_rand_ints_<uint64_t>(rnrg, 1, 12, 10'000);
+}
+
+TEST(rand_ints_tests, rand_ints__xoron64_range_engine__ok)
+{
+    rand::xoron64_range_engine<> rnrg(42);
+    check_rand_ints_<uint16_t>(rnrg, 1, 6, 100'000);
+    check_rand_ints_<int32_t>(rnrg, -1'000'000, 1'000'000, 100'000);
+    check_rand_ints_<uint64_t>(rnrg, 0, 999, 100'000);
+}
+
+TEST(rand_ints_tests, rand_ints__xorshift32_range_engine__ok)
+{
+    rand::xorshift32_range_engine<> rnrg(42);
+    check_rand_ints_<uint8_t>(rnrg, 10, 20, 10'000);
+    check_rand_ints_<int64_t>(rnrg, -3, 3, 10'000);
+}
+
+TEST(rand_ints_tests, rand_ints__high_rejection_rate__ok)
+{
+    // Almost half of the draws fall in the biased zone.
+    rand::xorshift64_range_engine<> rnrg(42);
+    check_rand_ints_<uint32_t>(rnrg, 0, (1u << 31), 100'000);
+    check_rand_ints_<uint64_t>(rnrg, 0, (1ull << 63), 100'000);
+}
+
+TEST(rand_ints_tests, rand_ints__seq_and_par__same_ints)
+{
+    const std::size_t size = 3 * rand::xorshift64_range_engine<>::parallel_block_size + 5;
+    std::vector<int64_t> seq_ints(size), par_ints(size);
+    rand::xorshift64_range_engine<> seq_rnrg(42), par_rnrg(42);
+    rand::rand_ints(std::span(seq_ints), -1'000, 1'000, seq_rnrg, std::execution::seq);
+    rand::rand_ints(std::span(par_ints), -1'000, 1'000, par_rnrg, std::execution::par);
+    ASSERT_EQ(seq_ints, par_ints);
+    ASSERT_EQ(seq_rnrg.seed(), par_rnrg.seed());
+}
+
+TEST(rand_ints_tests, rand_ints__distribution__balanced)
+{
+    rand::xorshift64_range_engine<> rnrg(42);
+    constexpr unsigned factor = 1000;
+    std::vector<uint16_t> ints(255 * factor);
+    rand::rand_ints(std::span(ints), 1, 255, rnrg);
+
+    std::array<unsigned, 256> counters{ 0 };
+    for (uint16_t value : ints)
+        ++counters.at(value);
+    EXPECT_EQ(counters.front(), 0);
+    std::ranges::for_each(std::ranges::subrange(counters.begin() + 1, counters.end()),
+                          [=](const auto& counter) { EXPECT_GE(counter, 0.9 * factor); });
+}
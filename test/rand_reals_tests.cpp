@@ -0,0 +1,88 @@
+#include <arba/rand/algorithm/rand_reals.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+TEST(rand_reals_tests, rand_doubles__closed_open__mantissa_of_the_words)
+{
+    const std::size_t size = 10'001;
+    std::vector<uint64_t> words(size);
+    rand::xorshift64_range_engine<> words_rnrg(42);
+    words_rnrg(std::span(words), cppx::endianness_specific);
+
+    std::vector<double> doubles(size);
+    rand::xorshift64_range_engine<> rnrg(42);
+    rand::rand_doubles(std::span(doubles), rnrg);
+    for (std::size_t i = 0; i < size; ++i)
+        ASSERT_EQ(doubles[i], std::ldexp(double(words[i] >> 12), -52));
+    ASSERT_EQ(rnrg.seed(), words_rnrg.seed());
+}
+
+TEST(rand_reals_tests, rand_floats__closed_open__mantissa_of_the_words)
+{
+    const std::size_t size = 10'001;
+    std::vector<uint32_t> words(size);
+    rand::xorshift32_range_engine<> words_rnrg(42);
+    words_rnrg(std::span(words), cppx::endianness_specific);
+
+    std::vector<float> floats(size);
+    rand::xorshift32_range_engine<> rnrg(42);
+    rand::rand_floats(std::span(floats), rnrg, rand::unit_interval::closed_open);
+    for (std::size_t i = 0; i < size; ++i)
+        ASSERT_EQ(floats[i], std::ldexp(float(words[i] >> 9), -23));
+}
+
+TEST(rand_reals_tests, rand_reals__open_closed__ok)
+{
+    std::vector<float> floats(100'000);
+    rand::xoron64_range_engine<> rnrg(42);
+    rand::rand_floats(std::span(floats), rnrg, rand::unit_interval::open_closed);
+    ASSERT_TRUE(std::ranges::all_of(floats, [](float value) { return 0.f < value && value <= 1.f; }));
+
+    std::vector<double> doubles(100'000);
+    rand::rand_doubles(std::span(doubles), rnrg, rand::unit_interval::open_closed);
+    ASSERT_TRUE(std::ranges::all_of(doubles, [](double value) { return 0. < value && value <= 1.; }));
+}
+
+TEST(rand_reals_tests, rand_reals__a_b__ok)
+{
+    rand::xorshift64_range_engine<> rnrg(42);
+    std::vector<double> doubles(100'000);
+    rand::rand_doubles(std::span(doubles), -3., 5., rnrg);
+    ASSERT_TRUE(std::ranges::all_of(doubles, [](double value) { return -3. <= value && value < 5.; }));
+    EXPECT_NEAR(std::reduce(doubles.cbegin(), doubles.cend()) / doubles.size(), 1., 0.05);
+
+    // The scale rounds many values up to b.
+    std::vector<float> floats(100'000);
+    rand::rand_floats(std::span(floats), 1.f, 1.0000002f, rnrg);
+    ASSERT_TRUE(std::ranges::all_of(floats, [](float value) { return 1.f <= value && value < 1.0000002f; }));
+}
+
+TEST(rand_reals_tests, rand_reals__distribution__balanced)
+{
+    rand::xorshift64_range_engine<> rnrg(42);
+    std::vector<double> doubles(256'000);
+    rand::rand_doubles(std::span(doubles), rnrg);
+
+    std::array<unsigned, 256> counters{ 0 };
+    for (double value : doubles)
+        ++counters.at(static_cast<std::size_t>(value * counters.size()));
+    std::ranges::for_each(counters, [](const auto& counter) { EXPECT_GE(counter, 900); });
+}
+
+TEST(rand_reals_tests, rand_reals__seq_and_par__same_reals)
+{
+    const std::size_t size = 3 * rand::xorshift64_range_engine<>::parallel_block_size + 5;
+    std::vector<double> seq_doubles(size), par_doubles(size);
+    rand::xorshift64_range_engine<> seq_rnrg(42), par_rnrg(42);
+    rand::rand_doubles(std::span(seq_doubles), -1., 1., seq_rnrg, std::execution::seq);
+    rand::rand_doubles(std::span(par_doubles), -1., 1., par_rnrg, std::execution::par);
+    ASSERT_EQ(seq_doubles, par_doubles);
+}
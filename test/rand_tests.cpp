@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <thread>
 
 // Tests rand_int<URNG, IT>(urng, [a, b])
 
@@ -34,7 +35,11 @@ TEST(rand_tests, test_rand_int)
 {
     rand::reseed(42);
     uint64_t value = rand::rand_int<uint64_t>();
+#if defined(ARBA_RAND_GLOBAL_ENGINE_MT19937_64)
     EXPECT_EQ(value, 13'930'160'852'258'120'406ULL);
+#else
+    EXPECT_EQ(value, 18'108'192'690'585'582'856ULL);
+#endif
 }
 
 TEST(rand_tests, test_reseed)
@@ -44,8 +49,30 @@ TEST(rand_tests, test_reseed)
     rand::reseed(42);
     uint64_t value_2 = rand::rand_int<uint64_t>(0, 1'000'000);
     ASSERT_EQ(value, value_2);
+#if defined(ARBA_RAND_GLOBAL_ENGINE_MT19937_64)
     ASSERT_EQ(value, 755'156);
-    ASSERT_EQ(value_2, 755'156);
+#else
+    ASSERT_EQ(value, 981'648);
+#endif
+}
+
+TEST(rand_tests, test_reseed_per_thread)
+{
+    rand::reseed(42);
+    const uint64_t value = rand::rand_int<uint64_t>();
+    uint64_t thread_value = 0;
+    uint64_t thread_reseeded_value = 0;
+    std::thread thread(
+        [&]
+        {
+            thread_value = rand::rand_int<uint64_t>();
+            rand::reseed(42);
+            thread_reseeded_value = rand::rand_int<uint64_t>();
+        });
+    thread.join();
+    ASSERT_NE(thread_value, value);
+    ASSERT_EQ(thread_reseeded_value, value);
+    ASSERT_NE(rand::rand_int<uint64_t>(), value);
 }
 
 TEST(rand_tests, test_rand_int_min_max)
@@ -0,0 +1,113 @@
+#include <arba/rand/rand.hpp>
+#include <arba/rand/rng/buffered_engine.hpp>
+#include <arba/rand/rng/urng.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using range_engine_t = rand::xoron64_range_engine<>;
+using random_number_generator_t = rand::buffered_engine<range_engine_t, 4096>;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(std::uniform_random_bit_generator<rand::buffered_engine<rand::xorshift32_range_engine<>>>);
+static_assert(random_number_generator_t::block_size == 512);
+
+// The values of several blocks, as generated by the range engine.
+static std::vector<result_t> expected_values(result_t seed, std::size_t nb_blocks)
+{
+    range_engine_t rnrg(seed);
+    std::vector<result_t> values(nb_blocks * random_number_generator_t::block_size);
+    for (std::size_t i = 0; i < nb_blocks; ++i)
+        rnrg(std::span(values).subspan(i * random_number_generator_t::block_size,
+                                       random_number_generator_t::block_size),
+             cppx::endianness_specific);
+    return values;
+}
+
+TEST(buffered_engine_tests, call__several_blocks__values_of_range_engine)
+{
+    const std::vector<result_t> expected = expected_values(42, 3);
+    random_number_generator_t rng(42);
+    std::vector<result_t> values(expected.size());
+    std::ranges::generate(values, std::ref(rng));
+    ASSERT_EQ(values, expected);
+}
+
+TEST(buffered_engine_tests, call__par_policy__same_values)
+{
+    rand::buffered_engine<range_engine_t, 1024 * 1024> rng(42);
+    rand::buffered_engine<range_engine_t, 1024 * 1024, std::execution::parallel_policy> par_rng(42);
+    for (std::size_t i = 0; i < 3 * decltype(rng)::block_size / 2; ++i)
+        ASSERT_EQ(rng(), par_rng());
+}
+
+TEST(buffered_engine_tests, seed__n__restart)
+{
+    random_number_generator_t rng(42);
+    const result_t first = rng();
+    (void)rng();
+    rng.seed(42);
+    EXPECT_EQ(rng(), first);
+    EXPECT_EQ(rng.available(), random_number_generator_t::block_size - 1);
+}
+
+TEST(buffered_engine_tests, discard__n__ok)
+{
+    const std::vector<result_t> expected = expected_values(42, 4);
+    for (unsigned long long times : { 0ull, 1ull, 511ull, 512ull, 513ull, 1500ull })
+    {
+        random_number_generator_t rng(42);
+        (void)rng();
+        rng.discard(times);
+        ASSERT_EQ(rng(), expected[times + 1]);
+    }
+}
+
+TEST(buffered_engine_tests, copy__same_continuation)
+{
+    random_number_generator_t rng(42);
+    rng.discard(700);
+    random_number_generator_t rng_copy(rng);
+    for (std::size_t i = 0; i < 1000; ++i)
+        ASSERT_EQ(rng(), rng_copy());
+}
+
+TEST(buffered_engine_tests, rand_int__min_max__in_range)
+{
+    random_number_generator_t rng(42);
+    std::array<unsigned, 7> counters{ 0 };
+    for (unsigned times = 6000; times; --times)
+        ++counters.at(rand::rand_int<uint8_t>(rng, 1, 6));
+    EXPECT_EQ(counters.front(), 0);
+    std::ranges::for_each(std::ranges::subrange(counters.begin() + 1, counters.end()),
+                          [](const auto& counter) { EXPECT_GE(counter, 900); });
+}
+
+TEST(buffered_engine_tests, uniform_engine__min_max__in_range)
+{
+    rand::uniform_engine<random_number_generator_t, uint32_t, 1, 100> rng(42);
+    for (unsigned times = 10000; times; --times)
+    {
+        const uint32_t value = rng();
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 100);
+    }
+}
+
+TEST(buffered_engine_tests, shuffle__permutation)
+{
+    std::vector<unsigned> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    random_number_generator_t rng(42);
+    std::ranges::shuffle(values, rng);
+    EXPECT_FALSE(std::ranges::is_sorted(values));
+    std::ranges::sort(values);
+    for (unsigned i = 0; i < values.size(); ++i)
+        ASSERT_EQ(values[i], i);
+}
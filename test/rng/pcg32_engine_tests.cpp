@@ -0,0 +1,91 @@
+#include <arba/rand/rand.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+#include <arba/rand/rng/urng.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using random_number_generator_t = rand::pcg32_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+// Reference values of pcg32-demo (pcg-c-basic): seed 42, stream 54.
+TEST(pcg32_engine_tests, pcg32_engine__reference_vector__ok)
+{
+    random_number_generator_t rng(42, 54);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_EQ(rng.stream(), 54);
+    EXPECT_EQ(rng(), 0xa15c02b7u);
+    EXPECT_EQ(rng(), 0x7b47f409u);
+    EXPECT_EQ(rng(), 0xba1d3330u);
+    EXPECT_EQ(rng(), 0x83d2f293u);
+    EXPECT_EQ(rng(), 0xbfa4784bu);
+    EXPECT_EQ(rng(), 0xcbed606eu);
+}
+
+TEST(pcg32_engine_tests, pcg32_engine__default_stream__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.stream(), 1442695040888963407ull >> 1);
+    EXPECT_EQ(rng(), 3'270'867'926u);
+    EXPECT_EQ(rng(), 1'795'671'209u);
+}
+
+TEST(pcg32_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42, 54);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng.stream(), 54);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(pcg32_engine_tests, streams__same_seed__different_values)
+{
+    random_number_generator_t rng(42, 1);
+    random_number_generator_t rng_2(42, 2);
+    std::vector<result_t> values(64), values_2(64);
+    std::ranges::generate(values, rng);
+    std::ranges::generate(values_2, rng_2);
+    EXPECT_NE(values, values_2);
+}
+
+TEST(pcg32_engine_tests, advance__n__same_as_steps)
+{
+    random_number_generator_t rng(42, 54);
+    random_number_generator_t rng_2 = rng;
+    for (int i = 0; i < 1000; ++i)
+        rng();
+    rng_2.advance(1000);
+    EXPECT_EQ(rng_2.state(), rng.state());
+    EXPECT_EQ(rng_2(), rng());
+}
+
+TEST(pcg32_engine_tests, advance__backward__ok)
+{
+    random_number_generator_t rng(42, 54);
+    const result_t first = rng();
+    rng.discard(1'000'000'000'000ull);
+    rng.advance(random_number_generator_t::state_type(-1'000'000'000'001ll));
+    EXPECT_EQ(rng(), first);
+}
+
+TEST(pcg32_engine_tests, uniform_engine__pcg32__ok)
+{
+    rand::uniform_engine<random_number_generator_t, uint32_t, 1, 6> engine(42);
+    for (int i = 0; i < 100; ++i)
+    {
+        const uint32_t value = engine();
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 6);
+    }
+    random_number_generator_t rng(42);
+    const int32_t value = rand::rand_int<int32_t>(rng, -5, 5);
+    EXPECT_GE(value, -5);
+    EXPECT_LE(value, 5);
+}
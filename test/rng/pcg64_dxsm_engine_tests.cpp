@@ -0,0 +1,52 @@
+#include <arba/rand/rand.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#ifdef __SIZEOF_INT128__
+
+using random_number_generator_t = rand::pcg64_dxsm_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+
+// Reference values of cm_setseq_dxsm_128_64 in pcg-cpp (pcg64_dxsm): seed 42, stream 54.
+TEST(pcg64_dxsm_engine_tests, pcg64_dxsm_engine__reference_vector__ok)
+{
+    random_number_generator_t rng(42, 54);
+    EXPECT_EQ(rng(), 17'331'114'245'835'578'256ull);
+    EXPECT_EQ(rng(), 10'267'467'544'499'227'306ull);
+    EXPECT_EQ(rng(), 9'726'600'296'081'716'989ull);
+    EXPECT_EQ(rng(), 10'165'951'391'103'677'450ull);
+}
+
+TEST(pcg64_dxsm_engine_tests, pcg64_dxsm_engine__default_stream__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng(), 1'594'238'167'195'962'991ull);
+    EXPECT_EQ(rng(), 5'815'028'641'645'623'189ull);
+}
+
+TEST(pcg64_dxsm_engine_tests, advance__n__same_as_steps)
+{
+    random_number_generator_t rng(42, 54);
+    random_number_generator_t rng_2 = rng;
+    for (int i = 0; i < 1000; ++i)
+        rng();
+    rng_2.discard(1000);
+    EXPECT_TRUE(rng_2.state() == rng.state());
+    EXPECT_EQ(rng_2(), rng());
+}
+
+TEST(pcg64_dxsm_engine_tests, rand_int__pcg64_dxsm__ok)
+{
+    random_number_generator_t rng(42, 7);
+    for (int i = 0; i < 100; ++i)
+    {
+        const int64_t value = rand::rand_int<int64_t>(rng, -1'000, 1'000);
+        ASSERT_GE(value, -1'000);
+        ASSERT_LE(value, 1'000);
+    }
+}
+
+#endif
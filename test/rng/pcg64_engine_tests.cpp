@@ -0,0 +1,102 @@
+#include <arba/rand/rand.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+#include <arba/rand/rng/urng.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifdef __SIZEOF_INT128__
+
+using random_number_generator_t = rand::pcg64_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+// Reference values of pcg64 in pcg-cpp: seed 42, stream 54.
+TEST(pcg64_engine_tests, pcg64_engine__reference_vector__ok)
+{
+    random_number_generator_t rng(42, 54);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_TRUE(rng.stream() == 54);
+    EXPECT_EQ(rng(), 0x86b1da1d72062b68ull);
+    EXPECT_EQ(rng(), 0x1304aa46c9853d39ull);
+    EXPECT_EQ(rng(), 0xa3670e9e0dd50358ull);
+    EXPECT_EQ(rng(), 0xf9090e529a7dae00ull);
+    EXPECT_EQ(rng(), 0xc85b9fd837996f2cull);
+    EXPECT_EQ(rng(), 0x606121f8e3919196ull);
+}
+
+TEST(pcg64_engine_tests, pcg64_engine__default_stream__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng(), 2'915'081'201'720'324'186ull);
+    EXPECT_EQ(rng(), 13'533'757'442'135'995'717ull);
+}
+
+TEST(pcg64_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42, 54);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_TRUE(rng.stream() == 54);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(pcg64_engine_tests, streams__same_seed__different_values)
+{
+    random_number_generator_t rng(42, 1);
+    random_number_generator_t rng_2(42, 2);
+    std::vector<result_t> values(64), values_2(64);
+    std::ranges::generate(values, rng);
+    std::ranges::generate(values_2, rng_2);
+    EXPECT_NE(values, values_2);
+}
+
+TEST(pcg64_engine_tests, streams__different_high_bits__different_values)
+{
+    const random_number_generator_t::state_type stream_id = random_number_generator_t::state_type(1) << 64;
+    random_number_generator_t rng(42, 1);
+    random_number_generator_t rng_2(42, stream_id | 1);
+    EXPECT_TRUE(rng_2.stream() == (stream_id | 1));
+    std::vector<result_t> values(64), values_2(64);
+    std::ranges::generate(values, rng);
+    std::ranges::generate(values_2, rng_2);
+    EXPECT_NE(values, values_2);
+}
+
+TEST(pcg64_engine_tests, advance__n__same_as_steps)
+{
+    random_number_generator_t rng(42, 54);
+    random_number_generator_t rng_2 = rng;
+    for (int i = 0; i < 1000; ++i)
+        rng();
+    rng_2.advance(1000);
+    EXPECT_TRUE(rng_2.state() == rng.state());
+    EXPECT_EQ(rng_2(), rng());
+}
+
+TEST(pcg64_engine_tests, advance__backward__ok)
+{
+    random_number_generator_t rng(42, 54);
+    const result_t first = rng();
+    rng.advance(random_number_generator_t::state_type(1) << 100);
+    rng.advance(-(random_number_generator_t::state_type(1) << 100) - 1);
+    EXPECT_EQ(rng(), first);
+}
+
+TEST(pcg64_engine_tests, uniform_engine__pcg64__ok)
+{
+    rand::uniform_engine<random_number_generator_t, uint64_t, 1, 6> engine(42);
+    for (int i = 0; i < 100; ++i)
+    {
+        const uint64_t value = engine();
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 6);
+    }
+}
+
+#endif
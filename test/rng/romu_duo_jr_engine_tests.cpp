@@ -0,0 +1,51 @@
+#include <arba/rand/rng/romu_engine.hpp>
+
+#include <gtest/gtest.h>
+
+using random_number_generator_t = rand::romu_duo_jr_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(romu_duo_jr_engine_tests, romu_duo_jr_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    const random_number_generator_t::state_type state{ 13'679'457'532'755'275'413ull, 2'949'826'092'126'892'291ull };
+    EXPECT_EQ(rng.state(), state);
+    EXPECT_EQ(rng(), 13'679'457'532'755'275'413ull);
+    EXPECT_EQ(rng(), 15'800'061'486'731'403'489ull);
+    EXPECT_EQ(rng(), 1'786'923'229'018'003'160ull);
+    EXPECT_EQ(rng(), 482'490'822'465'473'738ull);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(romu_duo_jr_engine_tests, romu_duo_jr_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng.state()[0], 0xe220a8397b1dcdafull);
+    const result_t first = rng();
+    const result_t second = rng();
+    EXPECT_NE(first, second);
+}
+
+TEST(romu_duo_jr_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(romu_duo_jr_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
@@ -0,0 +1,52 @@
+#include <arba/rand/rng/romu_engine.hpp>
+
+#include <gtest/gtest.h>
+
+using random_number_generator_t = rand::romu_trio_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(romu_trio_engine_tests, romu_trio_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    const random_number_generator_t::state_type state{ 13'679'457'532'755'275'413ull,
+                                                        2'949'826'092'126'892'291ull, 5'139'283'748'462'763'858ull };
+    EXPECT_EQ(rng.state(), state);
+    EXPECT_EQ(rng(), 13'679'457'532'755'275'413ull);
+    EXPECT_EQ(rng(), 16'166'196'199'208'028'934ull);
+    EXPECT_EQ(rng(), 7'302'561'994'169'334'510ull);
+    EXPECT_EQ(rng(), 13'559'289'063'277'200'459ull);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(romu_trio_engine_tests, romu_trio_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng.state()[0], 0xe220a8397b1dcdafull);
+    const result_t first = rng();
+    const result_t second = rng();
+    EXPECT_NE(first, second);
+}
+
+TEST(romu_trio_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(romu_trio_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
@@ -0,0 +1,47 @@
+#include <arba/rand/rng/sfc64_engine.hpp>
+
+#include <gtest/gtest.h>
+
+using random_number_generator_t = rand::sfc64_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(sfc64_engine_tests, sfc64_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_EQ(rng(), 9'593'766'767'639'209'231ull);
+    EXPECT_EQ(rng(), 7'993'095'875'549'472'148ull);
+    EXPECT_EQ(rng(), 7'611'607'860'230'059'198ull);
+    EXPECT_EQ(rng(), 11'103'719'255'792'862'824ull);
+    EXPECT_EQ(rng.state()[3], 17);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(sfc64_engine_tests, sfc64_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng(), 4'237'781'876'154'851'393ull);
+}
+
+TEST(sfc64_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(sfc64_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
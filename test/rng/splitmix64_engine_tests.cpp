@@ -0,0 +1,57 @@
+#include <arba/rand/rng/splitmix64_engine.hpp>
+
+#include <gtest/gtest.h>
+
+using random_number_generator_t = rand::splitmix64_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(splitmix64_engine_tests, splitmix64_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_EQ(rng(), 13'679'457'532'755'275'413ull);
+    EXPECT_EQ(rng(), 2'949'826'092'126'892'291ull);
+    EXPECT_EQ(rng(), 5'139'283'748'462'763'858ull);
+    EXPECT_EQ(rng(), 6'349'198'060'258'255'764ull);
+    EXPECT_EQ(rng.seed(), 42 + 4 * 0x9e3779b97f4a7c15ull);
+}
+
+TEST(splitmix64_engine_tests, splitmix64_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng(), 16'294'208'416'658'607'535ull);
+}
+
+TEST(splitmix64_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(splitmix64_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
+
+TEST(splitmix64_engine_tests, discard__large_n__ok)
+{
+    random_number_generator_t rng(42);
+    rng.discard(1'000'000);
+    random_number_generator_t rng_2(42);
+    for (unsigned i = 0; i < 1'000'000; ++i)
+        rng_2();
+    EXPECT_EQ(rng.seed(), rng_2.seed());
+    EXPECT_EQ(rng(), rng_2());
+}
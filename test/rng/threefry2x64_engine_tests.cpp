@@ -0,0 +1,94 @@
+#include <arba/rand/rand.hpp>
+#include <arba/rand/rng/counter_based_engine.hpp>
+#include <arba/rand/rng/urng.hpp>
+#include <arba/rand/threefry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+using random_number_generator_t = rand::threefry2x64_engine<>;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(threefry2x64_engine_tests, threefry2x64_engine__blocks_of_the_counters__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.key(), (rand::threefry2x64_key{ 42, 0 }));
+    const std::array<result_t, 4> expected = { 4'067'863'221'423'739'716ull, 3'724'856'962'928'600'647ull,
+                                               1'716'779'418'575'517'782ull, 11'541'679'320'895'791'575ull };
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(rng(), expected[i]) << i;
+    EXPECT_EQ(rng.position(), expected.size());
+}
+
+TEST(threefry2x64_engine_tests, threefry2x64_engine__key__kat_zeros)
+{
+    random_number_generator_t rng(rand::threefry2x64_key{ 0, 0 });
+    const rand::threefry2x64_counter expected = rand::threefry2x64({ 0, 0 }, { 0, 0 });
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(rng(), expected[i]) << i;
+}
+
+TEST(threefry2x64_engine_tests, value_at__high_block_index__ok)
+{
+    const random_number_generator_t rng(42);
+    const uint64_t block_index = (uint64_t(1) << 32) + 5;
+    EXPECT_EQ(rng.value_at(block_index * 2), 12'377'890'865'039'480'258ull);
+    EXPECT_EQ(rng.value_at(block_index * 2 + 1), 18'438'381'017'331'025'854ull);
+}
+
+TEST(threefry2x64_engine_tests, discard__n__same_as_value_at)
+{
+    random_number_generator_t rng(42);
+    std::vector<result_t> values(20);
+    for (result_t& value : values)
+        value = rng();
+    for (std::size_t n = 0; n < values.size(); ++n)
+    {
+        random_number_generator_t discarded_rng(42);
+        discarded_rng.discard(n);
+        ASSERT_EQ(discarded_rng(), values[n]) << n;
+        ASSERT_EQ(discarded_rng.value_at(n), values[n]) << n;
+    }
+}
+
+TEST(threefry2x64_engine_tests, set_position__backward__same_values)
+{
+    random_number_generator_t rng(42);
+    rng.discard(1'000'000'000'000ull);
+    const result_t alpha = rng();
+    const result_t beta = rng();
+    rng.set_position(1'000'000'000'000ull);
+    EXPECT_EQ(rng(), alpha);
+    EXPECT_EQ(rng(), beta);
+}
+
+TEST(threefry2x64_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng();
+    rng.seed(42);
+    ASSERT_EQ(rng.position(), 0u);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(threefry2x64_engine_tests, uniform_engine__threefry2x64__ok)
+{
+    rand::uniform_engine<random_number_generator_t, uint64_t, 1, 6> engine(42);
+    for (int i = 0; i < 100; ++i)
+    {
+        const uint64_t value = engine();
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 6);
+    }
+    random_number_generator_t rng(42);
+    const int32_t value = rand::rand_int<int32_t>(rng, -5, 5);
+    EXPECT_GE(value, -5);
+    EXPECT_LE(value, 5);
+}
@@ -89,3 +89,57 @@ TEST(urng_tests, test_urng_byte_min_max)
     std::ranges::for_each(std::ranges::subrange(counters.begin() + 1, counters.end()),
                           [=](const auto& counter) { EXPECT_GE(counter, 0.9 * factor); });
 }
+
+// Tests fast_urng_*
+
+static_assert(std::is_base_of_v<rand::wyrand_engine, rand::fast_urng_u32<>>);
+
+TEST(urng_tests, test_fast_urng_u8_min_max)
+{
+    rand::fast_urng_u8<1, 100> rng(42);
+    ASSERT_EQ(rng.min(), 1);
+    ASSERT_EQ(rng.max(), 100);
+
+    std::array<unsigned, decltype(rng)::max() + 1> counters{ 0 };
+
+    constexpr unsigned factor = 1000;
+    for (unsigned times = (counters.size() - 1) * factor; times; --times)
+    {
+        uint8_t index = rng();
+        ++counters.at(index);
+    }
+
+    EXPECT_EQ(counters.front(), 0);
+    std::ranges::for_each(std::ranges::subrange(counters.begin() + 1, counters.end()),
+                          [=](const auto& counter) { EXPECT_GE(counter, 0.9 * factor); });
+}
+
+TEST(urng_tests, test_fast_urng_i32)
+{
+    rand::fast_urng_i32 rng(42, -3, 2);
+    ASSERT_EQ(rng.distribution().a(), -3);
+    ASSERT_EQ(rng.distribution().b(), 2);
+
+    std::array<unsigned, 6> counters{ 0 };
+
+    constexpr unsigned factor = 1000;
+    for (unsigned times = counters.size() * factor; times; --times)
+    {
+        unsigned index = rng() + 3;
+        ++counters.at(index);
+    }
+
+    std::ranges::for_each(counters, [=](const auto& counter) { EXPECT_GE(counter, 0.9 * factor); });
+}
+
+TEST(urng_tests, test_fast_urng_u64__same_seed__same_sequence)
+{
+    rand::fast_urng_u64<0, 999'999'999'999> rng(42);
+    rand::fast_urng_u64<0, 999'999'999'999> rng_2(42);
+    for (unsigned i = 0; i < 100; ++i)
+    {
+        const uint64_t value = rng();
+        ASSERT_LE(value, 999'999'999'999ull);
+        ASSERT_EQ(value, rng_2());
+    }
+}
@@ -0,0 +1,57 @@
+#include <arba/rand/rng/wyrand_engine.hpp>
+
+#include <gtest/gtest.h>
+
+using random_number_generator_t = rand::wyrand_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(wyrand_engine_tests, wyrand_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_EQ(rng(), 12'558'987'674'375'533'620ull);
+    EXPECT_EQ(rng(), 16'846'851'108'956'068'306ull);
+    EXPECT_EQ(rng(), 14'652'274'819'296'609'082ull);
+    EXPECT_EQ(rng(), 16'945'271'478'357'465'713ull);
+    EXPECT_EQ(rng.seed(), 42 + 4 * 0xa0761d6478bd642full);
+}
+
+TEST(wyrand_engine_tests, wyrand_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng(), 1'233'057'930'238'600'590ull);
+}
+
+TEST(wyrand_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(wyrand_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
+
+TEST(wyrand_engine_tests, discard__large_n__ok)
+{
+    random_number_generator_t rng(42);
+    rng.discard(1'000'000);
+    random_number_generator_t rng_2(42);
+    for (unsigned i = 0; i < 1'000'000; ++i)
+        rng_2();
+    EXPECT_EQ(rng.seed(), rng_2.seed());
+    EXPECT_EQ(rng(), rng_2());
+}
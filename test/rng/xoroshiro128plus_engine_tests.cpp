@@ -0,0 +1,91 @@
+#include <arba/rand/rng/xoshiro_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+using random_number_generator_t = rand::xoroshiro128plus_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(xoroshiro128plus_engine_tests, xoroshiro128plus_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_EQ(rng.state(), rand::xoroshiro128_seed_state(42));
+    EXPECT_EQ(rng(), 16'629'283'624'882'167'704ull);
+    EXPECT_EQ(rng(), 1'420'492'921'613'871'959ull);
+    EXPECT_EQ(rng(), 9'768'315'062'676'884'790ull);
+    EXPECT_EQ(rng(), 5'968'755'422'790'022'214ull);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(xoroshiro128plus_engine_tests, xoroshiro128plus_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng.state()[0], 0xe220a8397b1dcdafull);
+    const result_t first = rng();
+    const result_t second = rng();
+    EXPECT_NE(first, second);
+}
+
+TEST(xoroshiro128plus_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(xoroshiro128plus_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
+
+TEST(xoroshiro128plus_engine_tests, discard__large_n__ok)
+{
+    random_number_generator_t rng(42);
+    rng.discard(1ull << 40);
+    rng.discard(1ull << 40);
+    EXPECT_EQ(rng.state(), rand::xoroshiro128_jump(random_number_generator_t(42).state(), 1ull << 41));
+}
+
+TEST(xoroshiro128plus_engine_tests, jump__ok)
+{
+    random_number_generator_t rng(42);
+    rng.jump();
+    EXPECT_EQ(rng.state(), rand::xoroshiro128_jump(rand::xoroshiro128_seed_state(42)));
+    EXPECT_EQ(rng(), 5'705'470'370'475'506'813ull);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(xoroshiro128plus_engine_tests, long_jump__ok)
+{
+    random_number_generator_t rng(42);
+    rng.long_jump();
+    EXPECT_EQ(rng.state(), rand::xoroshiro128_long_jump(rand::xoroshiro128_seed_state(42)));
+    EXPECT_EQ(rng(), 13'306'053'053'574'487'685ull);
+}
+
+TEST(xoroshiro128plus_engine_tests, jump__parallel_streams__distinct_values)
+{
+    std::array<random_number_generator_t, 4> rngs;
+    rngs.fill(random_number_generator_t(42));
+    for (std::size_t i = 1; i < rngs.size(); ++i)
+        for (std::size_t j = i; j < rngs.size(); ++j)
+            rngs[j].jump();
+    std::array<result_t, 4> values;
+    std::ranges::transform(rngs, values.begin(), [](random_number_generator_t& rng) { return rng(); });
+    std::ranges::sort(values);
+    EXPECT_EQ(std::ranges::adjacent_find(values), values.end());
+}
@@ -54,6 +54,17 @@ TEST(xorshift64_engine_tests, discard__n__ok)
     EXPECT_EQ(first, second);
 }
 
+TEST(xorshift64_engine_tests, discard__huge_n__ok)
+{
+    random_number_generator_t rng(42);
+    rng.discard(1ull << 40);
+    rng.discard(12'345);
+    random_number_generator_t rng_2(42);
+    rng_2.discard((1ull << 40) + 12'345);
+    EXPECT_EQ(rng(), rng_2());
+    EXPECT_EQ(rng.seed(), rand::xorshift64(rand::xorshift64_jump(42, (1ull << 40) + 12'345)));
+}
+
 TEST(xorshift64_engine_tests, xorshift64_engine__distribution__balanced)
 {
     random_number_generator_t rng(42);
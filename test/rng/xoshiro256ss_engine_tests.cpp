@@ -0,0 +1,91 @@
+#include <arba/rand/rng/xoshiro_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+using random_number_generator_t = rand::xoshiro256ss_engine;
+using result_t = random_number_generator_t::result_type;
+
+static_assert(std::uniform_random_bit_generator<random_number_generator_t>);
+static_assert(random_number_generator_t::min() == std::numeric_limits<result_t>::min());
+static_assert(random_number_generator_t::max() == std::numeric_limits<result_t>::max());
+
+TEST(xoshiro256ss_engine_tests, xoshiro256ss_engine__positive_seed__ok)
+{
+    random_number_generator_t rng(42);
+    EXPECT_EQ(rng.seed(), 42);
+    EXPECT_EQ(rng.state(), rand::xoshiro256_seed_state(42));
+    EXPECT_EQ(rng(), 1'546'998'764'402'558'742ull);
+    EXPECT_EQ(rng(), 6'990'951'692'964'543'102ull);
+    EXPECT_EQ(rng(), 12'544'586'762'248'559'009ull);
+    EXPECT_EQ(rng(), 17'057'574'109'182'124'193ull);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(xoshiro256ss_engine_tests, xoshiro256ss_engine__null_seed__ok)
+{
+    random_number_generator_t rng(0);
+    EXPECT_EQ(rng.state()[0], 0xe220a8397b1dcdafull);
+    const result_t first = rng();
+    const result_t second = rng();
+    EXPECT_NE(first, second);
+}
+
+TEST(xoshiro256ss_engine_tests, seed__n__ok)
+{
+    random_number_generator_t rng(42);
+    const result_t value = rng();
+    rng.seed(42);
+    ASSERT_EQ(rng(), value);
+}
+
+TEST(xoshiro256ss_engine_tests, discard__n__ok)
+{
+    random_number_generator_t rng(42);
+    rng();
+    rng();
+    const result_t value = rng();
+    random_number_generator_t rng_2(42);
+    rng_2.discard(2);
+    EXPECT_EQ(rng_2(), value);
+}
+
+TEST(xoshiro256ss_engine_tests, discard__large_n__ok)
+{
+    random_number_generator_t rng(42);
+    rng.discard(1ull << 40);
+    rng.discard(1ull << 40);
+    EXPECT_EQ(rng.state(), rand::xoshiro256_jump(random_number_generator_t(42).state(), 1ull << 41));
+}
+
+TEST(xoshiro256ss_engine_tests, jump__ok)
+{
+    random_number_generator_t rng(42);
+    rng.jump();
+    EXPECT_EQ(rng.state(), rand::xoshiro256_jump(rand::xoshiro256_seed_state(42)));
+    EXPECT_EQ(rng(), 5'766'981'335'298'035'530ull);
+    EXPECT_EQ(rng.seed(), 42);
+}
+
+TEST(xoshiro256ss_engine_tests, long_jump__ok)
+{
+    random_number_generator_t rng(42);
+    rng.long_jump();
+    EXPECT_EQ(rng.state(), rand::xoshiro256_long_jump(rand::xoshiro256_seed_state(42)));
+    EXPECT_EQ(rng(), 11'575'600'654'643'926'073ull);
+}
+
+TEST(xoshiro256ss_engine_tests, jump__parallel_streams__distinct_values)
+{
+    std::array<random_number_generator_t, 4> rngs;
+    rngs.fill(random_number_generator_t(42));
+    for (std::size_t i = 1; i < rngs.size(); ++i)
+        for (std::size_t j = i; j < rngs.size(); ++j)
+            rngs[j].jump();
+    std::array<result_t, 4> values;
+    std::ranges::transform(rngs, values.begin(), [](random_number_generator_t& rng) { return rng(); });
+    std::ranges::sort(values);
+    EXPECT_EQ(std::ranges::adjacent_find(values), values.end());
+}
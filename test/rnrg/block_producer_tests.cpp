@@ -0,0 +1,91 @@
+#include <arba/rand/rnrg/block_producer.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using range_engine_t = rand::xoron64_range_engine<>;
+using block_producer_t = rand::block_producer<range_engine_t>;
+using integer_t = block_producer_t::integer_type;
+
+TEST(block_producer_tests, acquire__single_consumer__sequence_of_range_engine)
+{
+    constexpr std::size_t block_bytes = 64 * 1024;
+    block_producer_t producer(42, block_bytes, 3);
+    ASSERT_EQ(producer.block_size(), block_bytes / sizeof(integer_t));
+    ASSERT_EQ(producer.number_of_blocks(), 3);
+
+    range_engine_t rnrg(42);
+    std::vector<integer_t> expected(producer.block_size());
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        rnrg(std::span(expected), cppx::endianness_specific);
+        const block_producer_t::block_handle handle = producer.acquire();
+        ASSERT_TRUE(std::ranges::equal(handle.integers(), expected));
+        ASSERT_EQ(handle.bytes().size(), block_bytes);
+    }
+
+    const rand::block_producer_metrics metrics = producer.metrics();
+    EXPECT_EQ(metrics.nb_acquired_blocks, 10);
+    EXPECT_GE(metrics.nb_produced_blocks, 10);
+    EXPECT_LE(metrics.nb_produced_blocks, 13);
+    EXPECT_LE(metrics.nb_stalls, 10);
+    EXPECT_GE(metrics.max_refill_duration, metrics.mean_refill_duration());
+}
+
+TEST(block_producer_tests, try_acquire__all_blocks_held__nullopt)
+{
+    rand::block_producer<rand::xorshift64_range_engine<>> producer(42, 4096, 2);
+    std::vector<rand::block_producer<rand::xorshift64_range_engine<>>::block_handle> handles;
+    handles.push_back(producer.acquire());
+    handles.push_back(producer.acquire());
+    ASSERT_FALSE(producer.try_acquire().has_value());
+    handles.front().release();
+    const auto handle = producer.acquire();
+    EXPECT_EQ(producer.metrics().nb_acquired_blocks, 3);
+}
+
+TEST(block_producer_tests, acquire__several_consumers__all_blocks_distinct)
+{
+    constexpr unsigned nb_consumers = 4;
+    constexpr unsigned nb_blocks_per_consumer = 50;
+    block_producer_t producer(42, 4096, 4);
+
+    std::vector<std::vector<integer_t>> first_values(nb_consumers);
+    std::vector<std::jthread> consumers;
+    for (unsigned c = 0; c < nb_consumers; ++c)
+        consumers.emplace_back(
+            [&, c]
+            {
+                for (unsigned i = 0; i < nb_blocks_per_consumer; ++i)
+                    first_values[c].push_back(producer.acquire().integers().front());
+            });
+    consumers.clear();
+
+    std::vector<integer_t> all_values;
+    for (const std::vector<integer_t>& values : first_values)
+        all_values.insert(all_values.end(), values.begin(), values.end());
+    std::ranges::sort(all_values);
+    EXPECT_EQ(std::ranges::adjacent_find(all_values), all_values.end());
+    EXPECT_EQ(producer.metrics().nb_acquired_blocks, nb_consumers * nb_blocks_per_consumer);
+}
+
+TEST(block_producer_tests, destructor__producer_waiting__no_hang)
+{
+    using producer_t = rand::block_producer<rand::xorshift64_range_engine<>>;
+    for (unsigned i = 0; i < 2000; ++i)
+    {
+        producer_t producer(i + 1, 64, 2);
+        // Every block held, then given back just before the destruction: the producer refills them and waits for
+        // free blocks while the stop is requested.
+        std::vector<producer_t::block_handle> handles;
+        handles.push_back(producer.acquire());
+        handles.push_back(producer.acquire());
+        ASSERT_FALSE(producer.try_acquire().has_value());
+        handles.clear();
+    }
+}
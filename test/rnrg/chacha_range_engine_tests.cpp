@@ -0,0 +1,215 @@
+#include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/chacha.hpp>
+#include <arba/rand/rnrg/chacha_range_engine.hpp>
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/rnrg/rnrg_benchmark.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <ranges>
+#include <vector>
+
+#include "each_simd_isa.hpp"
+
+#if __has_include(<sys/wait.h>) && __has_include(<unistd.h>)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using random_number_range_generator_t = rand::chacha_range_engine<>;
+using integer_t = random_number_range_generator_t::integer_type;
+
+static_assert(rand::RandomNumberRangeGenerator<random_number_range_generator_t>);
+static_assert(rand::RandomNumberRangeGenerator<rand::chacha_range_engine<8>>);
+
+constexpr rand::chacha_key key_ = { 1, 2, 3, 4, 5, 6, 7, 8 };
+constexpr uint64_t nonce_ = 0x0123'4567'89ab'cdefull;
+
+// Keystream of the key from block first_block on.
+template <unsigned Rounds = 20>
+std::vector<integer_t> keystream_(const rand::chacha_key& key, std::size_t size, uint64_t first_block = 0)
+{
+    std::vector<integer_t> ints;
+    for (uint64_t block_index = first_block; ints.size() < size; ++block_index)
+    {
+        const rand::chacha_block block = rand::chacha<Rounds>(key, block_index, nonce_);
+        ints.insert(ints.end(), block.begin(), block.end());
+    }
+    ints.resize(size);
+    return ints;
+}
+
+TEST(chacha_range_engine_tests, generate_random_ints__key__keystream)
+{
+    random_number_range_generator_t rnrg(key_, nonce_);
+    std::vector<integer_t> ints(1000);
+    rnrg(std::span(ints), cppx::endianness_specific);
+    ASSERT_EQ(ints, keystream_(key_, ints.size()));
+}
+
+TEST(chacha_range_engine_tests, generate_random_ints__next_request__new_key)
+{
+    random_number_range_generator_t rnrg(key_, nonce_);
+    std::vector<integer_t> ints(37);
+    rnrg(std::span(ints), cppx::endianness_specific);
+
+    // The key of the next request is the first words of the block following the partial third one, the counter
+    // restarting at 0.
+    const std::vector<integer_t> fourth_block = keystream_(key_, 16, 3);
+    rand::chacha_key next_key;
+    std::ranges::copy(std::span(fourth_block).first(next_key.size()), next_key.begin());
+    rnrg(std::span(ints), cppx::endianness_specific);
+    ASSERT_EQ(ints, keystream_(next_key, ints.size()));
+}
+
+TEST(chacha_range_engine_tests, generate_random_bytes__remaining_bytes__ok)
+{
+    random_number_range_generator_t rnrg(key_, nonce_);
+    std::array<std::byte, 5 * sizeof(integer_t) + 3> bytes;
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    const integer_t value = keystream_(key_, 6).back();
+    ASSERT_TRUE(std::ranges::equal(std::span(bytes).last(3), std::as_bytes(std::span(&value, 1)).first(3)));
+}
+
+TEST(chacha_range_engine_tests, generate_random__endianness_neutral__ok)
+{
+    const std::size_t container_size = 1031;
+
+    random_number_range_generator_t rnrg(72);
+    std::vector<integer_t> alpha_ints(container_size), beta_ints(container_size);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg(std::span(beta_ints), cppx::endianness_neutral);
+
+    const bool expected_cmp_result = std::endian::native == std::endian::big;
+    ASSERT_TRUE(std::ranges::equal(alpha_ints, beta_ints) == expected_cmp_result);
+    for (std::size_t i = 0; i < container_size; ++i)
+        ASSERT_EQ(alpha_ints[i], core::wtoh_when(beta_ints[i], cppx::endianness_neutral));
+}
+
+TEST(chacha_range_engine_tests, discard__n__ok)
+{
+    random_number_range_generator_t rnrg(key_, nonce_);
+    rnrg.discard(21);
+    std::array<integer_t, 43> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    const std::vector<integer_t> keystream = keystream_(key_, 64);
+    ASSERT_TRUE(std::ranges::equal(ints, std::span(keystream).last(43)));
+}
+
+TEST(chacha_range_engine_tests, constructor__random_device__different_keystreams)
+{
+    random_number_range_generator_t rnrg, rnrg_2;
+    std::array<integer_t, 16> ints, ints_2;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    rnrg_2(std::span(ints_2), cppx::endianness_specific);
+    ASSERT_NE(ints, ints_2);
+}
+
+#if __has_include(<sys/wait.h>) && __has_include(<unistd.h>)
+TEST(chacha_range_engine_tests, generate_random_ints__after_fork__reseeded)
+{
+    random_number_range_generator_t rnrg;
+    int pipe_fds[2];
+    ASSERT_EQ(pipe(pipe_fds), 0);
+    const pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    std::array<integer_t, 16> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    if (pid == 0)
+    {
+        close(pipe_fds[0]);
+        const bool written = write(pipe_fds[1], ints.data(), sizeof(ints)) == sizeof(ints);
+        _exit(written ? 0 : 1);
+    }
+    // Without its write end in the parent, the pipe reaches its end when the child exits without writing.
+    close(pipe_fds[1]);
+    std::array<integer_t, 16> child_ints;
+    const ssize_t read_size = read(pipe_fds[0], child_ints.data(), sizeof(child_ints));
+    close(pipe_fds[0]);
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0) << status;
+    ASSERT_EQ(read_size, ssize_t(sizeof(child_ints)));
+    ASSERT_NE(ints, child_ints);
+}
+#endif
+
+// Generates the bytes from a counter crossing 2^32 blocks in the middle of the request, then rewrites their first half.
+static void generate_twice_(auto& rnrg, std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+{
+    rnrg.discard(((uint64_t(1) << 32) - 7) * 16 + 5);
+    rnrg(bytes, endianness_policy);
+    rnrg(bytes.first(bytes.size() / 2), endianness_policy);
+}
+
+TEST(chacha_range_engine_tests, generate_random_bytes__each_simd_isa_specific__same_as_scalar)
+{
+    const auto generate = [](auto& rnrg, std::span<std::byte> bytes)
+    { generate_twice_(rnrg, bytes, cppx::endianness_specific); };
+    const std::size_t container_size = 1000 * sizeof(integer_t) + 3;
+    generate_with_each_simd_isa<rand::chacha_range_engine<8>>(container_size, generate, key_, nonce_);
+    generate_with_each_simd_isa<rand::chacha_range_engine<12>>(container_size, generate, key_, nonce_);
+    generate_with_each_simd_isa<rand::chacha_range_engine<20>>(container_size, generate, key_, nonce_);
+}
+
+TEST(chacha_range_engine_tests, generate_random_bytes__each_simd_isa_neutral__same_as_scalar)
+{
+    generate_with_each_simd_isa<rand::chacha_range_engine<20>>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { generate_twice_(rnrg, bytes, cppx::endianness_neutral); }, key_,
+        nonce_);
+}
+
+TEST(chacha_range_engine_tests, generate_random_bytes__seq_and_par__same_bytes)
+{
+    const std::size_t container_size = 4 * 1024 * 1024 + 5;
+
+    random_number_range_generator_t rnrg(72);
+    std::vector<std::byte> bytes(container_size, std::byte{ 0 });
+    rnrg(std::span(bytes), cppx::endianness_neutral);
+
+    random_number_range_generator_t par_rnrg(72);
+    std::vector<std::byte> par_bytes(container_size, std::byte{ 0 });
+    par_rnrg(std::span(par_bytes), cppx::endianness_neutral, std::execution::par);
+    ASSERT_TRUE(std::ranges::equal(par_bytes, bytes));
+
+    std::array<integer_t, 16> next_ints, par_next_ints;
+    rnrg(std::span(next_ints), cppx::endianness_neutral);
+    par_rnrg(std::span(par_next_ints), cppx::endianness_neutral, std::execution::par);
+    ASSERT_EQ(par_next_ints, next_ints);
+}
+
+TEST(chacha_range_engine_tests, rnrg_benchmark)
+{
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result bm_res =
+        benchmark.compute(rnrg, rand::bit_balanced_uint32s::enumerators, 1024 * 1024 + 7);
+    std::cout << "AH: " << bm_res.average_homogeneous_byte_distribution_index << std::endl;
+    std::cout << "AU: " << bm_res.average_integer_uniqueness_index << std::endl;
+    std::cout << "AD: " << bm_res.average_execution_duration << std::endl;
+    ASSERT_GT(bm_res.average_homogeneous_byte_distribution_index, 0.99);
+    ASSERT_GT(bm_res.average_integer_uniqueness_index, 0.99);
+}
+
+#ifdef ARBA_CPPX_EXECUTION_ALL_STD_POLICIES
+TEST(chacha_range_engine_tests, rnrg_benchmark__parallel_seeds__same_as_sequential)
+{
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const auto seeds = rand::bit_balanced_uint32s::enumerators | std::views::take(4);
+    const rand::rnrg_benchmark_result sequential_bm_res =
+        benchmark.compute(rnrg, seeds, 256 * 1024, std::execution::par);
+    benchmark.parallel_seeds = true;
+    benchmark.max_parallel_seeds = 3;
+    const rand::rnrg_benchmark_result parallel_bm_res = benchmark.compute(rnrg, seeds, 256 * 1024, std::execution::par);
+    EXPECT_EQ(parallel_bm_res.homogeneous_byte_distribution_indexes,
+              sequential_bm_res.homogeneous_byte_distribution_indexes);
+    EXPECT_EQ(parallel_bm_res.integer_uniqueness_indexes, sequential_bm_res.integer_uniqueness_indexes);
+}
+#endif
@@ -0,0 +1,252 @@
+#include <arba/rand/algorithm/counter_based_fill.hpp>
+#include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/rng/counter_based_engine.hpp>
+#include <arba/rand/rnrg/counter_based_range_engine.hpp>
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/rnrg/rnrg_benchmark.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "each_simd_isa.hpp"
+
+struct philox4x32_params_
+{
+    using random_number_generator_t = rand::philox4x32_engine<>;
+    using random_number_range_generator_t = rand::philox4x32_range_engine<>;
+
+    static std::span<std::byte> fill(const std::span<std::byte> bytes, const rand::philox4x32_key& key,
+                                     uint64_t first_index)
+    {
+        return rand::philox4x32_fill(bytes, key, first_index, cppx::endianness_specific, std::execution::seq);
+    }
+
+    static constexpr const auto& seeds = rand::bit_balanced_uint32s::enumerators;
+    static constexpr bool unique_integers = false;
+};
+
+struct threefry2x64_params_
+{
+    using random_number_generator_t = rand::threefry2x64_engine<>;
+    using random_number_range_generator_t = rand::threefry2x64_range_engine<>;
+
+    static std::span<std::byte> fill(const std::span<std::byte> bytes, const rand::threefry2x64_key& key,
+                                     uint64_t first_index)
+    {
+        return rand::threefry2x64_fill(bytes, key, first_index, cppx::endianness_specific, std::execution::seq);
+    }
+
+    static constexpr const auto& seeds = rand::bit_balanced_uint64s::enumerators;
+    // The 64-bit values of a few MiB do not collide.
+    static constexpr bool unique_integers = true;
+};
+
+static_assert(rand::RandomNumberRangeGenerator<philox4x32_params_::random_number_range_generator_t>);
+static_assert(rand::RandomNumberRangeGenerator<threefry2x64_params_::random_number_range_generator_t>);
+
+template <class ParamsT>
+class counter_based_range_engine_tests : public testing::Test
+{
+public:
+    using random_number_generator_t = typename ParamsT::random_number_generator_t;
+    using random_number_range_generator_t = typename ParamsT::random_number_range_generator_t;
+    using integer_t = typename random_number_range_generator_t::integer_type;
+};
+
+using counter_based_params = testing::Types<philox4x32_params_, threefry2x64_params_>;
+TYPED_TEST_SUITE(counter_based_range_engine_tests, counter_based_params);
+
+TYPED_TEST(counter_based_range_engine_tests, constructor__positive_seed__ok)
+{
+    using random_number_generator_t = typename TestFixture::random_number_generator_t;
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+
+    random_number_range_generator_t rnrg(42);
+    EXPECT_EQ(rnrg.key(), random_number_generator_t(42).key());
+    EXPECT_EQ(rnrg.position(), 0u);
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random_ints__same_as_engine__ok)
+{
+    using random_number_generator_t = typename TestFixture::random_number_generator_t;
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    random_number_generator_t rng(42);
+    random_number_range_generator_t rnrg(42);
+    std::array<integer_t, 37> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    for (std::size_t i = 0; i < ints.size(); ++i)
+        ASSERT_EQ(ints[i], rng()) << i;
+
+    // The next request starts in the middle of a block.
+    rnrg(std::span(ints).first(10), cppx::endianness_specific);
+    for (std::size_t i = 0; i < 10; ++i)
+        ASSERT_EQ(ints[i], rng()) << i;
+    ASSERT_EQ(rnrg.position(), rng.position());
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random_bytes__remaining_bytes__ok)
+{
+    using random_number_generator_t = typename TestFixture::random_number_generator_t;
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    random_number_generator_t rng(42);
+    random_number_range_generator_t rnrg(42);
+    std::array<std::byte, 5 * sizeof(integer_t) + 3> bytes;
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    const integer_t value = rng.value_at(5);
+    ASSERT_TRUE(std::ranges::equal(std::span(bytes).last(3), std::as_bytes(std::span(&value, 1)).first(3)));
+    ASSERT_EQ(rnrg.position(), 6u);
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random_bytes__cut_requests__same_bytes_when_whole_words)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    random_number_range_generator_t rnrg(42);
+    std::array<std::byte, 10 * sizeof(integer_t)> bytes;
+    rnrg(std::span(bytes), cppx::endianness_specific);
+
+    // Requests of whole words give the same bytes however they are cut.
+    random_number_range_generator_t cut_rnrg(42);
+    std::array<std::byte, 10 * sizeof(integer_t)> cut_bytes;
+    cut_rnrg(std::span(cut_bytes).first(3 * sizeof(integer_t)), cppx::endianness_specific);
+    cut_rnrg(std::span(cut_bytes).subspan(3 * sizeof(integer_t), sizeof(integer_t)), cppx::endianness_specific);
+    cut_rnrg(std::span(cut_bytes).last(6 * sizeof(integer_t)), cppx::endianness_specific);
+    ASSERT_EQ(cut_bytes, bytes);
+
+    // A partial word consumes the whole value: the next request starts at the next value.
+    random_number_range_generator_t partial_rnrg(42);
+    std::array<std::byte, 3> partial_bytes;
+    partial_rnrg(std::span(partial_bytes), cppx::endianness_specific);
+    ASSERT_EQ(partial_rnrg.position(), 1u);
+    std::array<std::byte, sizeof(integer_t)> next_bytes;
+    partial_rnrg(std::span(next_bytes), cppx::endianness_specific);
+    ASSERT_TRUE(std::ranges::equal(std::span(partial_bytes), std::span(bytes).first(3)));
+    ASSERT_TRUE(std::ranges::equal(next_bytes, std::span(bytes).subspan(sizeof(integer_t), sizeof(integer_t))));
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random__endianness_neutral__ok)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    const std::size_t container_size = 1031;
+
+    random_number_range_generator_t rnrg(72);
+    std::vector<integer_t> alpha_ints(container_size), beta_ints(container_size);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg(std::span(beta_ints), cppx::endianness_neutral);
+
+    const bool expected_cmp_result = std::endian::native == std::endian::big;
+    ASSERT_TRUE(std::ranges::equal(alpha_ints, beta_ints) == expected_cmp_result);
+    for (std::size_t i = 0; i < container_size; ++i)
+        ASSERT_EQ(alpha_ints[i], core::wtoh_when(beta_ints[i], cppx::endianness_neutral));
+}
+
+TYPED_TEST(counter_based_range_engine_tests, discard__n__ok)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    std::array<integer_t, 64> alpha_ints, beta_ints;
+    random_number_range_generator_t rnrg(72);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg.discard(21);
+    rnrg(std::span(beta_ints).first(43), cppx::endianness_specific);
+    ASSERT_TRUE(std::ranges::equal(std::span(alpha_ints).last(43), std::span(beta_ints).first(43)));
+}
+
+TYPED_TEST(counter_based_range_engine_tests, fill__first_index__same_as_value_at)
+{
+    using random_number_generator_t = typename TestFixture::random_number_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    const random_number_generator_t rng(42);
+    const uint64_t first_index = (uint64_t(1) << 34) - 123;
+    std::vector<integer_t> ints(1000);
+    TypeParam::fill(std::as_writable_bytes(std::span(ints)), rng.key(), first_index);
+    for (std::size_t i = 0; i < ints.size(); ++i)
+        ASSERT_EQ(ints[i], rng.value_at(first_index + i)) << i;
+}
+
+// Generates half of the bytes from a position near 2^34 (a request starting in a block), then all of them.
+static void generate_twice_(auto& rnrg, std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+{
+    rnrg.set_position((uint64_t(1) << 34) - 123);
+    rnrg(bytes.first(bytes.size() / 2), endianness_policy);
+    rnrg(bytes, endianness_policy);
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random_bytes__each_simd_isa_specific__same_as_scalar)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    generate_with_each_simd_isa<random_number_range_generator_t>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { generate_twice_(rnrg, bytes, cppx::endianness_specific); }, 72);
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random_bytes__each_simd_isa_neutral__same_as_scalar)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    generate_with_each_simd_isa<random_number_range_generator_t>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { generate_twice_(rnrg, bytes, cppx::endianness_neutral); }, 72);
+}
+
+TYPED_TEST(counter_based_range_engine_tests, generate_random_bytes__seq_and_par__same_bytes)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+    using integer_t = typename TestFixture::integer_t;
+
+    const std::size_t container_size = 4 * 1024 * 1024 + 5;
+
+    random_number_range_generator_t rnrg(72);
+    std::vector<std::byte> bytes(container_size, std::byte{ 0 });
+    rnrg(std::span(bytes), cppx::endianness_neutral);
+
+    random_number_range_generator_t par_rnrg(72);
+    std::vector<std::byte> par_bytes(container_size, std::byte{ 0 });
+    par_rnrg(std::span(par_bytes), cppx::endianness_neutral, std::execution::par);
+    ASSERT_TRUE(std::ranges::equal(par_bytes, bytes));
+
+    std::array<integer_t, 16> next_ints, par_next_ints;
+    rnrg(std::span(next_ints), cppx::endianness_neutral);
+    par_rnrg(std::span(par_next_ints), cppx::endianness_neutral, std::execution::par);
+    ASSERT_EQ(par_next_ints, next_ints);
+}
+
+TYPED_TEST(counter_based_range_engine_tests, rnrg_benchmark)
+{
+    using random_number_range_generator_t = typename TestFixture::random_number_range_generator_t;
+
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result bm_res = benchmark.compute(rnrg, TypeParam::seeds, 1024 * 1024 + 7);
+    std::cout << "AH: " << bm_res.average_homogeneous_byte_distribution_index << std::endl;
+    std::cout << "AU: " << bm_res.average_integer_uniqueness_index << std::endl;
+    std::cout << "AD: " << bm_res.average_execution_duration << std::endl;
+    ASSERT_GT(bm_res.average_homogeneous_byte_distribution_index, 0.99);
+    if constexpr (TypeParam::unique_integers)
+    {
+        ASSERT_EQ(bm_res.average_integer_uniqueness_index, 1.);
+    }
+    else
+    {
+        ASSERT_GT(bm_res.average_integer_uniqueness_index, 0.99);
+    }
+}
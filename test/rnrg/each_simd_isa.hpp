@@ -0,0 +1,39 @@
+#pragma once
+
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// Expects generate(rnrg, bytes), called on a RnrgT built from the args, to write the same bytes with each detected
+// SIMD ISA as with the scalar code. The seeds left are compared too when RnrgT returns its seed.
+template <class RnrgT, class GenerateT, class... ArgsT>
+void generate_with_each_simd_isa(const std::size_t container_size, GenerateT generate, const ArgsT&... args)
+{
+    const rand::simd_isa max_isa = rand::max_simd_isa();
+    rand::set_max_simd_isa(rand::simd_isa::scalar);
+    RnrgT scalar_rnrg(args...);
+    std::vector<std::byte> scalar_bytes(container_size, std::byte{ 0 });
+    generate(scalar_rnrg, std::span(scalar_bytes));
+
+    for (rand::simd_isa isa : { rand::simd_isa::avx2, rand::simd_isa::avx512 })
+    {
+        if (isa > rand::detected_simd_isa())
+            continue;
+        rand::set_max_simd_isa(isa);
+        RnrgT rnrg(args...);
+        std::vector<std::byte> bytes(container_size, std::byte{ 0 });
+        generate(rnrg, std::span(bytes));
+        EXPECT_TRUE(std::ranges::equal(bytes, scalar_bytes)) << rand::to_string(isa);
+        if constexpr (requires { { rnrg.seed() } -> std::equality_comparable; })
+        {
+            EXPECT_EQ(rnrg.seed(), scalar_rnrg.seed()) << rand::to_string(isa);
+        }
+    }
+    rand::set_max_simd_isa(max_isa);
+}
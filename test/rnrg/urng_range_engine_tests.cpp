@@ -0,0 +1,107 @@
+#include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/rnrg/rnrg_benchmark.hpp>
+#include <arba/rand/rnrg/urng_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+static_assert(rand::RandomNumberRangeGenerator<rand::urng_range_engine<rand::pcg32_engine>>);
+static_assert(rand::RandomNumberRangeGenerator<rand::urng_range_engine<std::mt19937_64>>);
+
+TEST(urng_range_engine_tests, generate_random_ints__values_of_the_urng__ok)
+{
+    rand::urng_range_engine<rand::pcg32_engine> rnrg(42, 54);
+    rand::pcg32_engine rng(42, 54);
+    std::array<uint32_t, 33> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    for (uint32_t value : ints)
+        ASSERT_EQ(value, rng());
+    ASSERT_EQ(rnrg.urng().state(), rng.state());
+}
+
+TEST(urng_range_engine_tests, seed__64_bits_seed__same_as_urng)
+{
+    const uint64_t seed = 0x1234'5678'9abc'def0ull;
+    rand::urng_range_engine<rand::pcg32_engine> rnrg(1);
+    rnrg.seed(seed);
+    const rand::urng_range_engine<rand::pcg32_engine> constructed_rnrg(seed);
+    EXPECT_EQ(rnrg.urng().seed(), seed);
+    EXPECT_EQ(rnrg.urng().state(), constructed_rnrg.urng().state());
+    EXPECT_NE(rnrg.urng().state(), rand::pcg32_engine(uint32_t(seed)).state());
+}
+
+TEST(urng_range_engine_tests, generate_random_bytes__remaining_bytes__ok)
+{
+    rand::urng_range_engine<rand::xorshift64_engine> rnrg(42);
+    rand::xorshift64_engine rng(42);
+    std::array<std::byte, 2 * sizeof(uint64_t) + 5> bytes;
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    rng.discard(2);
+    const uint64_t value = rng();
+    ASSERT_TRUE(std::ranges::equal(std::span(bytes).last(5), std::as_bytes(std::span(&value, 1)).first(5)));
+}
+
+TEST(urng_range_engine_tests, generate_random__endianness_neutral__ok)
+{
+    rand::urng_range_engine<rand::pcg32_engine> rnrg(72);
+    std::vector<uint32_t> alpha_ints(1031), beta_ints(1031);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg(std::span(beta_ints), cppx::endianness_neutral);
+    for (std::size_t i = 0; i < alpha_ints.size(); ++i)
+        ASSERT_EQ(alpha_ints[i], core::wtoh_when(beta_ints[i], cppx::endianness_neutral));
+}
+
+template <class RangeEngineT>
+void generate_seq_and_par_()
+{
+    using integer_t = typename RangeEngineT::integer_type;
+    const std::size_t container_size = 3 * RangeEngineT::parallel_block_size * sizeof(integer_t) + 7;
+
+    RangeEngineT rnrg(72);
+    std::vector<std::byte> bytes(container_size, std::byte{ 0 });
+    rnrg(std::span(bytes), cppx::endianness_neutral);
+
+    RangeEngineT par_rnrg(72);
+    std::vector<std::byte> par_bytes(container_size, std::byte{ 0 });
+    par_rnrg(std::span(par_bytes), cppx::endianness_neutral, std::execution::par);
+    ASSERT_TRUE(std::ranges::equal(par_bytes, bytes));
+
+    std::array<integer_t, 8> next_ints, par_next_ints;
+    rnrg(std::span(next_ints), cppx::endianness_neutral);
+    par_rnrg(std::span(par_next_ints), cppx::endianness_neutral, std::execution::par);
+    ASSERT_EQ(par_next_ints, next_ints);
+}
+
+TEST(urng_range_engine_tests, generate_random_bytes__seq_and_par__same_bytes)
+{
+    generate_seq_and_par_<rand::urng_range_engine<rand::pcg32_engine>>();
+#ifdef __SIZEOF_INT128__
+    generate_seq_and_par_<rand::urng_range_engine<rand::pcg64_engine>>();
+    generate_seq_and_par_<rand::urng_range_engine<rand::pcg64_dxsm_engine>>();
+#endif
+    // Without advance(), the parallel requests are sequential.
+    generate_seq_and_par_<rand::urng_range_engine<rand::xorshift64_engine>>();
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(urng_range_engine_tests, rnrg_benchmark)
+{
+    rand::urng_range_engine<rand::pcg64_dxsm_engine> rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result bm_res =
+        benchmark.compute(rnrg, rand::bit_balanced_uint64s::enumerators, 1024 * 1024 + 7);
+    std::cout << "AH: " << bm_res.average_homogeneous_byte_distribution_index << std::endl;
+    std::cout << "AU: " << bm_res.average_integer_uniqueness_index << std::endl;
+    std::cout << "AD: " << bm_res.average_execution_duration << std::endl;
+    ASSERT_GT(bm_res.average_homogeneous_byte_distribution_index, 0.99);
+    ASSERT_EQ(bm_res.average_integer_uniqueness_index, 1.);
+}
+#endif
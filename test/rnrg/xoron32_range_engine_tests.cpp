@@ -0,0 +1,116 @@
+#include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/rnrg/rnrg_benchmark.hpp>
+#include <arba/rand/rnrg/xoron32_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using random_number_range_generator_t = rand::xoron32_range_engine<>;
+using integer_t = random_number_range_generator_t::integer_type;
+
+TEST(xoron32_range_engine_tests, constructor__positive_seed__ok)
+{
+    random_number_range_generator_t rnrg(42);
+    EXPECT_EQ(rnrg.seed(), 42);
+}
+
+TEST(xoron32_range_engine_tests, masks__bit_balanced_uint32s__ok)
+{
+    EXPECT_EQ(random_number_range_generator_t::alpha_xor_mask, rand::bit_balanced_uint32s::caac.value());
+    EXPECT_EQ(random_number_range_generator_t::beta_xor_mask, rand::bit_balanced_uint32s::c0de.value());
+}
+
+TEST(xoron32_range_engine_tests, generate_random_bytes__le_default_init_range_size__ok)
+{
+    const integer_t seed = 42;
+
+    random_number_range_generator_t rnrg(seed);
+    std::array<std::byte, 2000> alpha_bytes, beta_bytes;
+    rnrg(std::span(alpha_bytes), cppx::endianness_specific);
+    rand::xorshift32_range_engine<> xs32rg(seed);
+    xs32rg(std::span(beta_bytes), cppx::endianness_specific);
+    ASSERT_TRUE(std::ranges::equal(alpha_bytes, beta_bytes));
+}
+
+TEST(xoron32_range_engine_tests, generate_random_bytes__check_operations__ok)
+{
+    const integer_t seed = 42;
+
+    random_number_range_generator_t rnrg(seed);
+    std::array<std::byte, 8000> bytes_array;
+    std::span bytes(bytes_array);
+    rnrg(bytes, cppx::endianness_specific);
+
+    integer_t n = core::as_uint<sizeof(integer_t) * 8>(bytes.subspan(1, 4));
+    n ^= random_number_range_generator_t::alpha_xor_mask;
+    n = std::rotl(n, 3);
+    integer_t w = core::as_uint<sizeof(integer_t) * 8>(bytes.subspan(2048, 4));
+    ASSERT_EQ(n, w);
+
+    // The beta copy starts after the alpha one: (2048 - 1) / 4 words.
+    n = core::as_uint<sizeof(integer_t) * 8>(bytes.subspan(1, 4));
+    n ^= random_number_range_generator_t::beta_xor_mask;
+    n = ~std::rotr(n, 3);
+    w = core::as_uint<sizeof(integer_t) * 8>(bytes.subspan(2048 + (2048 - 1) / 4 * 4, 4));
+    ASSERT_EQ(n, w);
+}
+
+TEST(xoron32_range_engine_tests, generate_random__endianness_neutral__ok)
+{
+    const integer_t seed = 72;
+    const std::size_t container_size = 4103;
+
+    random_number_range_generator_t rnrg(seed);
+    std::vector<integer_t> alpha_ints(container_size), beta_ints(container_size);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(seed);
+    rnrg(std::span(beta_ints), cppx::endianness_neutral);
+
+    const bool expected_cmp_result = std::endian::native == std::endian::big;
+    ASSERT_TRUE(std::ranges::equal(alpha_ints, beta_ints) == expected_cmp_result);
+    ASSERT_EQ(alpha_ints.front(), core::wtoh_when(beta_ints.front(), cppx::endianness_neutral));
+}
+
+TEST(xoron32_range_engine_tests, generate_random_bytes__seq_par_untiled__same_bytes)
+{
+    using untiled_range_generator_t =
+        rand::xoron32_range_engine<rand::xorshift32_range_engine<>, 2048, 0xcaac'caac, 0xc0de'c0de, 0>;
+
+    const std::size_t container_size = 3 * 1024 * 1024 + 3;
+    std::vector<std::byte> bytes(container_size), par_bytes(container_size), untiled_bytes(container_size);
+    random_number_range_generator_t rnrg(42);
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    rnrg.seed(42);
+    rnrg(std::span(par_bytes), cppx::endianness_specific, std::execution::par);
+    untiled_range_generator_t untiled_rnrg(42);
+    untiled_rnrg(std::span(untiled_bytes), cppx::endianness_specific);
+    ASSERT_EQ(par_bytes, bytes);
+    ASSERT_EQ(untiled_bytes, bytes);
+}
+
+TEST(xoron32_range_engine_tests, seed__s__ok)
+{
+    random_number_range_generator_t rnrg(72);
+    std::array<std::byte, 32 * sizeof(integer_t) - 1> alpha_bytes, beta_bytes;
+    rnrg(std::span(alpha_bytes), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg(std::span(beta_bytes), cppx::endianness_specific);
+    ASSERT_TRUE(std::ranges::equal(alpha_bytes, beta_bytes));
+}
+
+TEST(xoron32_range_engine_tests, rnrg_benchmark)
+{
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result bm_res =
+        benchmark.compute(rnrg, rand::bit_balanced_uint32s::enumerators, 1024 * 1024 + 7);
+    std::cout << "AH: " << bm_res.average_homogeneous_byte_distribution_index << std::endl;
+    std::cout << "AU: " << bm_res.average_integer_uniqueness_index << std::endl;
+    std::cout << "AD: " << bm_res.average_execution_duration << std::endl;
+    ASSERT_GT(bm_res.average_homogeneous_byte_distribution_index, 0.99);
+    ASSERT_GT(bm_res.average_integer_uniqueness_index, 0.90);
+}
@@ -3,14 +3,18 @@
 #include <arba/rand/rnrg/rnrg_benchmark.hpp>
 #include <arba/rand/rnrg/xoron64_range_engine.hpp>
 #include <arba/rand/rnrg/xorshift_range_engine.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
 
 #include <arba/cppx/policy/execution_policy.hpp>
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
 #include <ranges>
 #include <vector>
 
+#include "each_simd_isa.hpp"
+
 using random_number_generator_t = rand::xorshift64_engine;
 
 TEST(xoron64_range_engine_tests, constructor__positive_seed__ok)
@@ -170,6 +174,69 @@ TEST(xoron64_range_engine_tests, discard__n__ok)
     ASSERT_TRUE(std::ranges::equal(alpha_bytes, beta_bytes));
 }
 
+TEST(xoron64_range_engine_tests, generate_random_bytes__tiled__same_as_untiled)
+{
+    using untiled_range_generator_t = rand::xoron64_range_engine<rand::xorshift64_range_engine<>, 2048,
+                                                                 0xA6B6C6D6A6B6C6A6ull, 0x6A6B6C6D6A6B6C6Aull, 0>;
+    using tiled_range_generator_t = rand::xoron64_range_engine<rand::xorshift64_range_engine<>, 2048,
+                                                               0xA6B6C6D6A6B6C6A6ull, 0x6A6B6C6D6A6B6C6Aull, 4096>;
+    static_assert(rand::xoron64_range_engine<>::tile_bytes == rand::xoron64_default_tile_bytes);
+
+    const std::size_t container_size = 3 * 1024 * 1024 + 5;
+    std::vector<std::byte> untiled_bytes(container_size), tiled_bytes(container_size), default_bytes(container_size);
+
+    untiled_range_generator_t untiled_rnrg(42);
+    untiled_rnrg(std::span(untiled_bytes), cppx::endianness_specific);
+    tiled_range_generator_t tiled_rnrg(42);
+    tiled_rnrg(std::span(tiled_bytes), cppx::endianness_specific);
+    ASSERT_EQ(tiled_bytes, untiled_bytes);
+    tiled_rnrg.seed(42);
+    tiled_rnrg(std::span(tiled_bytes), cppx::endianness_specific, std::execution::par);
+    ASSERT_EQ(tiled_bytes, untiled_bytes);
+    rand::xoron64_range_engine<> default_rnrg(42);
+    default_rnrg(std::span(default_bytes), cppx::endianness_specific);
+    ASSERT_EQ(default_bytes, untiled_bytes);
+
+    untiled_rnrg.seed(42);
+    untiled_rnrg(std::span(untiled_bytes), cppx::endianness_neutral);
+    tiled_rnrg.seed(42);
+    tiled_rnrg(std::span(tiled_bytes), cppx::endianness_neutral, std::execution::par);
+    ASSERT_EQ(tiled_bytes, untiled_bytes);
+}
+
+// Generates the bytes sequentially, then expects the parallel generation from the same seed to write the same bytes.
+static void generate_seq_and_par_(auto& rnrg, std::span<std::byte> bytes, uint64_t seed,
+                                  cppx::EndiannessPolicy auto endianness_policy)
+{
+    rnrg(bytes, endianness_policy);
+    std::vector<std::byte> par_bytes(bytes.size(), std::byte{ 0 });
+    rnrg.seed(seed);
+    rnrg(std::span(par_bytes), endianness_policy, std::execution::par);
+    EXPECT_TRUE(std::ranges::equal(par_bytes, bytes)) << rand::to_string(rand::max_simd_isa()) << " par";
+}
+
+TEST(xoron64_range_engine_tests, generate_random_bytes__each_simd_isa_specific__same_as_scalar)
+{
+    using random_number_range_generator_t = rand::xoron64_range_engine<>;
+
+    const uint64_t seed = 72;
+    generate_with_each_simd_isa<random_number_range_generator_t>(
+        1024 * 1024 + 7,
+        [=](auto& rnrg, std::span<std::byte> bytes)
+        { generate_seq_and_par_(rnrg, bytes, seed, cppx::endianness_specific); }, seed);
+}
+
+TEST(xoron64_range_engine_tests, generate_random_bytes__each_simd_isa_neutral__same_as_scalar)
+{
+    using random_number_range_generator_t = rand::xoron64_range_engine<>;
+
+    const uint64_t seed = 72;
+    generate_with_each_simd_isa<random_number_range_generator_t>(
+        1024 * 1024 + 7,
+        [=](auto& rnrg, std::span<std::byte> bytes)
+        { generate_seq_and_par_(rnrg, bytes, seed, cppx::endianness_neutral); }, seed);
+}
+
 TEST(xoron64_range_engine_tests, rnrg_benchmark)
 {
     using random_number_range_generator_t = rand::xoron64_range_engine<>;
@@ -181,6 +248,122 @@ TEST(xoron64_range_engine_tests, rnrg_benchmark)
     std::cout << "AH: " << bm_res.average_homogeneous_byte_distribution_index << std::endl;
     std::cout << "AU: " << bm_res.average_integer_uniqueness_index << std::endl;
     std::cout << "AD: " << bm_res.average_execution_duration << std::endl;
+    std::cout << "AM: " << bm_res.average_measurement_duration << std::endl;
     ASSERT_GT(bm_res.average_homogeneous_byte_distribution_index, 0.99);
     ASSERT_GT(bm_res.average_integer_uniqueness_index, 0.90);
+    ASSERT_EQ(bm_res.measurement_durations.size(), bm_res.execution_durations.size());
+    ASSERT_GE(bm_res.average_measurement_duration, 0.);
+}
+
+TEST(xoron64_range_engine_tests, rnrg_benchmark__range_inspector__unmodified_ranges)
+{
+    using random_number_range_generator_t = rand::xoron64_range_engine<>;
+    constexpr std::size_t nb_bytes = 1024 * 1024 + 7;
+    const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(3);
+
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    std::vector<std::vector<std::byte>> ranges;
+    benchmark.range_inspector = [&](std::size_t seed_index, std::span<const std::byte> bytes)
+    {
+        ASSERT_EQ(seed_index, ranges.size());
+        ranges.emplace_back(bytes.begin(), bytes.end());
+    };
+    benchmark.compute(rnrg, seeds, nb_bytes);
+    ASSERT_EQ(ranges.size(), 3);
+
+    std::vector<std::byte> bytes(nb_bytes);
+    for (std::size_t i = 0; i < ranges.size(); ++i)
+    {
+        random_number_range_generator_t expected_rnrg(seeds[i]);
+        expected_rnrg(std::span(bytes), cppx::endianness_specific);
+        EXPECT_EQ(ranges[i], bytes);
+    }
+}
+
+TEST(xoron64_range_engine_tests, rnrg_benchmark__approximate_uniqueness__near_exact)
+{
+    using random_number_range_generator_t = rand::xoron64_range_engine<>;
+    constexpr std::size_t nb_bytes = 4 * 1024 * 1024;
+    const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(2);
+
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result exact_bm_res = benchmark.compute(rnrg, seeds, nb_bytes);
+    benchmark.approximate_integer_uniqueness_index = true;
+    const rand::rnrg_benchmark_result approximate_bm_res = benchmark.compute(rnrg, seeds, nb_bytes);
+    EXPECT_EQ(exact_bm_res.average_homogeneous_byte_distribution_index,
+              approximate_bm_res.average_homogeneous_byte_distribution_index);
+    EXPECT_NEAR(approximate_bm_res.average_integer_uniqueness_index, exact_bm_res.average_integer_uniqueness_index,
+                0.015);
+    EXPECT_LE(approximate_bm_res.average_integer_uniqueness_index, 1.);
+}
+
+TEST(xoron64_range_engine_tests, rnrg_benchmark__statistical_tests__ok)
+{
+    using random_number_range_generator_t = rand::xoron64_range_engine<>;
+    constexpr std::size_t nb_bytes = 1024 * 1024;
+    const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(2);
+
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark{ false, false };
+    benchmark.compute_statistical_tests(true);
+    benchmark.compute_entropy_test = false;
+    const rand::rnrg_benchmark_result bm_res = benchmark.compute(rnrg, seeds, nb_bytes);
+    for (const rand::statistical_test test : rand::statistical_tests)
+    {
+        const std::vector<rand::statistical_test_result>& results = bm_res.results_of(test);
+        ASSERT_EQ(results.size(), 2) << rand::to_string(test);
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            if (test == rand::statistical_test::entropy)
+            {
+                EXPECT_TRUE(std::isnan(results[i].p_value));
+                continue;
+            }
+            std::vector<std::byte> bytes(nb_bytes);
+            random_number_range_generator_t expected_rnrg(seeds[i]);
+            expected_rnrg(std::span(bytes), cppx::endianness_specific);
+            const rand::statistical_test_result expected_result = rand::run_statistical_test(test, bytes);
+            EXPECT_EQ(results[i].statistic, expected_result.statistic) << rand::to_string(test);
+            EXPECT_EQ(results[i].p_value, expected_result.p_value) << rand::to_string(test);
+        }
+    }
+}
+
+#ifdef ARBA_CPPX_EXECUTION_ALL_STD_POLICIES
+TEST(xoron64_range_engine_tests, rnrg_benchmark__parallel_seeds__same_as_sequential)
+{
+    using random_number_range_generator_t = rand::xoron64_range_engine<>;
+    constexpr std::size_t nb_bytes = 1024 * 1024 + 7;
+    const auto seeds = rand::bit_balanced_uint64s::enumerators | std::views::take(6);
+
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result sequential_bm_res = benchmark.compute(rnrg, seeds, nb_bytes, std::execution::par);
+    for (const std::size_t memory_budget : { std::size_t(0), 3 * nb_bytes * 2, std::size_t(1) << 32 })
+    {
+        benchmark.parallel_seeds = true;
+        benchmark.parallel_seeds_memory_budget = memory_budget;
+        benchmark.max_parallel_seeds = 4;
+        std::vector<std::size_t> inspected_seed_indexes;
+        benchmark.range_inspector = [&](std::size_t seed_index, std::span<const std::byte> bytes)
+        {
+            inspected_seed_indexes.push_back(seed_index);
+            random_number_range_generator_t expected_rnrg(seeds[seed_index]);
+            std::vector<std::byte> expected_bytes(nb_bytes);
+            expected_rnrg(std::span(expected_bytes), cppx::endianness_specific);
+            EXPECT_TRUE(std::ranges::equal(bytes, expected_bytes));
+        };
+        const rand::rnrg_benchmark_result parallel_bm_res =
+            benchmark.compute(rnrg, seeds, nb_bytes, std::execution::par);
+        EXPECT_EQ(parallel_bm_res.seeds, sequential_bm_res.seeds);
+        EXPECT_EQ(parallel_bm_res.homogeneous_byte_distribution_indexes,
+                  sequential_bm_res.homogeneous_byte_distribution_indexes);
+        EXPECT_EQ(parallel_bm_res.integer_uniqueness_indexes, sequential_bm_res.integer_uniqueness_indexes);
+        EXPECT_EQ(parallel_bm_res.execution_durations.size(), 6);
+        EXPECT_EQ(parallel_bm_res.measurement_durations.size(), 6);
+        EXPECT_EQ(inspected_seed_indexes, (std::vector<std::size_t>{ 0, 1, 2, 3, 4, 5 }));
+    }
 }
+#endif
@@ -0,0 +1,87 @@
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xoron64_stream_engine.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using stream_engine_t = rand::xoron64_stream_engine<rand::xorshift64_range_engine<>, 16 * 1024>;
+using integer_t = stream_engine_t::integer_type;
+
+static_assert(rand::RandomNumberRangeGenerator<stream_engine_t>);
+
+// Concatenation of windows generated by successive calls of the in-memory engine.
+static std::vector<std::byte> expected_stream(integer_t seed, std::size_t nb_windows)
+{
+    stream_engine_t::window_engine_type rnrg(seed);
+    std::vector<std::byte> bytes(nb_windows * stream_engine_t::window_bytes);
+    for (std::size_t i = 0; i < nb_windows; ++i)
+        rnrg(std::span(bytes).subspan(i * stream_engine_t::window_bytes, stream_engine_t::window_bytes),
+             cppx::endianness_specific);
+    return bytes;
+}
+
+TEST(xoron64_stream_engine_tests, call__whole_span__windows_of_range_engine)
+{
+    const std::vector<std::byte> expected = expected_stream(42, 5);
+    stream_engine_t rnrg(42);
+    EXPECT_EQ(rnrg.seed(), 42);
+    std::vector<std::byte> bytes(expected.size());
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    ASSERT_EQ(bytes, expected);
+}
+
+TEST(xoron64_stream_engine_tests, call__uneven_requests__same_stream)
+{
+    const std::vector<std::byte> expected = expected_stream(42, 5);
+    stream_engine_t rnrg(42);
+    std::vector<std::byte> bytes(expected.size());
+    std::span<std::byte> remaining_bytes(bytes);
+    for (std::size_t request_size = 1; !remaining_bytes.empty(); request_size = request_size * 3 + 5)
+    {
+        const std::size_t size = std::min(request_size % 40'000, remaining_bytes.size());
+        rnrg(remaining_bytes.first(size), cppx::endianness_specific);
+        remaining_bytes = remaining_bytes.subspan(size);
+    }
+    ASSERT_EQ(bytes, expected);
+}
+
+TEST(xoron64_stream_engine_tests, call__par_policy__same_stream)
+{
+    const std::vector<std::byte> expected = expected_stream(42, 5);
+    stream_engine_t rnrg(42);
+    std::vector<std::byte> bytes(expected.size());
+    rnrg(std::span(bytes).first(1000), cppx::endianness_specific, std::execution::par);
+    rnrg(std::span(bytes).subspan(1000), cppx::endianness_specific, std::execution::par);
+    ASSERT_EQ(bytes, expected);
+}
+
+TEST(xoron64_stream_engine_tests, generate__sink__same_stream_by_windows)
+{
+    const std::vector<std::byte> expected = expected_stream(42, 5);
+    stream_engine_t rnrg(42);
+    std::vector<std::byte> bytes;
+    std::size_t max_size = 0;
+    const auto sink = [&](std::span<const std::byte> window_bytes)
+    {
+        bytes.insert(bytes.end(), window_bytes.begin(), window_bytes.end());
+        max_size = std::max(max_size, window_bytes.size());
+    };
+    rnrg.generate(100, sink, cppx::endianness_specific);
+    rnrg.generate(expected.size() - 100, sink, cppx::endianness_specific);
+    ASSERT_EQ(bytes, expected);
+    EXPECT_EQ(max_size, stream_engine_t::window_bytes);
+}
+
+TEST(xoron64_stream_engine_tests, seed__n__restart)
+{
+    stream_engine_t rnrg(42);
+    std::vector<std::byte> bytes(1000), bytes_2(1000);
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    rnrg.seed(42);
+    rnrg(std::span(bytes_2), cppx::endianness_specific);
+    ASSERT_EQ(bytes, bytes_2);
+}
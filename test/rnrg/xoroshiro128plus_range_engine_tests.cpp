@@ -0,0 +1,201 @@
+#include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/rng/xoshiro_engine.hpp>
+#include <arba/rand/rnrg/random_number_range_generator.hpp>
+#include <arba/rand/rnrg/rnrg_benchmark.hpp>
+#include <arba/rand/rnrg/xoshiro_range_engine.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "each_simd_isa.hpp"
+
+using random_number_generator_t = rand::xoroshiro128plus_engine;
+using random_number_range_generator_t = rand::xoroshiro128plus_range_engine<>;
+using integer_t = random_number_range_generator_t::integer_type;
+
+static_assert(rand::RandomNumberRangeGenerator<random_number_range_generator_t>);
+
+// Scalar engines of the lanes of a range engine seeded with seed.
+template <std::size_t LaneCount>
+std::array<random_number_generator_t, LaneCount> make_lane_engines_(integer_t seed)
+{
+    std::array<random_number_generator_t, LaneCount> rngs;
+    rngs.fill(random_number_generator_t(seed));
+    for (std::size_t i = 1; i < LaneCount; ++i)
+        for (std::size_t j = i; j < LaneCount; ++j)
+            rngs[j].long_jump();
+    return rngs;
+}
+
+TEST(xoroshiro128plus_range_engine_tests, constructor__positive_seed__ok)
+{
+    random_number_range_generator_t rnrg(42);
+    EXPECT_EQ(rnrg.seed(), 42);
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random_ints__interleaved_lanes__ok)
+{
+    constexpr std::size_t number_of_lanes = random_number_range_generator_t::number_of_lanes;
+    std::array<random_number_generator_t, number_of_lanes> rngs = make_lane_engines_<number_of_lanes>(42);
+
+    random_number_range_generator_t rnrg(42);
+    std::array<integer_t, 3 * number_of_lanes + 1> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    for (std::size_t i = 0; i < ints.size(); ++i)
+        ASSERT_EQ(ints[i], rngs[i % number_of_lanes]()) << i;
+
+    // The lanes keep running from one call to the next.
+    rnrg(std::span(ints).first(number_of_lanes), cppx::endianness_specific);
+    for (std::size_t i = 0; i < number_of_lanes; ++i)
+        ASSERT_EQ(ints[i], rngs[i]()) << i;
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random_bytes__remaining_bytes__ok)
+{
+    constexpr std::size_t number_of_lanes = random_number_range_generator_t::number_of_lanes;
+    std::array<random_number_generator_t, number_of_lanes> rngs = make_lane_engines_<number_of_lanes>(42);
+
+    random_number_range_generator_t rnrg(42);
+    std::array<std::byte, number_of_lanes * sizeof(integer_t) + 3> bytes;
+    rnrg(std::span(bytes), cppx::endianness_specific);
+    rngs[0]();
+    const integer_t value = rngs[0]();
+    ASSERT_TRUE(std::ranges::equal(std::span(bytes).last(3), std::as_bytes(std::span(&value, 1)).first(3)));
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random_ints__blocks__jumped_lanes)
+{
+    constexpr std::size_t number_of_lanes = random_number_range_generator_t::number_of_lanes;
+    constexpr std::size_t parallel_block_size = random_number_range_generator_t::parallel_block_size;
+    std::array<random_number_generator_t, number_of_lanes> rngs = make_lane_engines_<number_of_lanes>(42);
+
+    random_number_range_generator_t rnrg(42);
+    std::vector<integer_t> ints(2 * parallel_block_size + number_of_lanes);
+    rnrg(std::span(ints), cppx::endianness_specific);
+    for (std::size_t i = 0; i < number_of_lanes; ++i)
+    {
+        rngs[i].jump();
+        random_number_generator_t rng = rngs[i];
+        ASSERT_EQ(ints[parallel_block_size + i], rng()) << i;
+        rngs[i].jump();
+        ASSERT_EQ(ints[2 * parallel_block_size + i], rngs[i]()) << i;
+    }
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random__endianness_neutral__ok)
+{
+    const std::size_t container_size = 1031;
+
+    random_number_range_generator_t rnrg(72);
+    std::vector<integer_t> alpha_ints(container_size), beta_ints(container_size);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg(std::span(beta_ints), cppx::endianness_neutral);
+
+    const bool expected_cmp_result = std::endian::native == std::endian::big;
+    ASSERT_TRUE(std::ranges::equal(alpha_ints, beta_ints) == expected_cmp_result);
+    for (std::size_t i = 0; i < container_size; ++i)
+        ASSERT_EQ(alpha_ints[i], core::wtoh_when(beta_ints[i], cppx::endianness_neutral));
+}
+
+TEST(xoroshiro128plus_range_engine_tests, discard__n__ok)
+{
+    constexpr std::size_t number_of_lanes = random_number_range_generator_t::number_of_lanes;
+    std::array<integer_t, 4 * number_of_lanes> alpha_ints, beta_ints;
+    random_number_range_generator_t rnrg(72);
+    rnrg(std::span(alpha_ints), cppx::endianness_specific);
+    rnrg.seed(72);
+    rnrg.discard(2);
+    rnrg(std::span(beta_ints).first(2 * number_of_lanes), cppx::endianness_specific);
+    ASSERT_TRUE(std::ranges::equal(std::span(alpha_ints).last(2 * number_of_lanes),
+                                   std::span(beta_ints).first(2 * number_of_lanes)));
+}
+
+TEST(xoroshiro128plus_range_engine_tests, discard__large_n__same_as_lane_engines)
+{
+    constexpr std::size_t number_of_lanes = random_number_range_generator_t::number_of_lanes;
+    std::array<random_number_generator_t, number_of_lanes> rngs = make_lane_engines_<number_of_lanes>(42);
+
+    random_number_range_generator_t rnrg(42);
+    rnrg.discard(1ull << 40);
+    std::array<integer_t, number_of_lanes> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    for (std::size_t i = 0; i < number_of_lanes; ++i)
+    {
+        rngs[i].discard(1ull << 40);
+        ASSERT_EQ(ints[i], rngs[i]()) << i;
+    }
+}
+
+TEST(xoroshiro128plus_range_engine_tests, jump__non_overlapping_lanes__ok)
+{
+    constexpr std::size_t number_of_lanes = random_number_range_generator_t::number_of_lanes;
+    std::array<random_number_generator_t, 2 * number_of_lanes> rngs = make_lane_engines_<2 * number_of_lanes>(42);
+
+    random_number_range_generator_t rnrg(42);
+    rnrg.jump();
+    std::array<integer_t, number_of_lanes> ints;
+    rnrg(std::span(ints), cppx::endianness_specific);
+    for (std::size_t i = 0; i < number_of_lanes; ++i)
+        ASSERT_EQ(ints[i], rngs[number_of_lanes + i]()) << i;
+}
+
+// Generates the bytes, then rewrites their first half.
+static void generate_twice_(auto& rnrg, std::span<std::byte> bytes, cppx::EndiannessPolicy auto endianness_policy)
+{
+    rnrg(bytes, endianness_policy);
+    rnrg(bytes.first(bytes.size() / 2), endianness_policy);
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random_bytes__each_simd_isa_specific__same_as_scalar)
+{
+    generate_with_each_simd_isa<rand::xoroshiro128plus_range_engine<16>>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { generate_twice_(rnrg, bytes, cppx::endianness_specific); },
+        integer_t(72));
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random_bytes__each_simd_isa_neutral__same_as_scalar)
+{
+    generate_with_each_simd_isa<rand::xoroshiro128plus_range_engine<16>>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { generate_twice_(rnrg, bytes, cppx::endianness_neutral); },
+        integer_t(72));
+}
+
+TEST(xoroshiro128plus_range_engine_tests, generate_random_bytes__seq_and_par__same_bytes)
+{
+    const std::size_t container_size = 4 * random_number_range_generator_t::parallel_block_size * sizeof(integer_t) + 5;
+
+    random_number_range_generator_t rnrg(72);
+    std::vector<std::byte> bytes(container_size, std::byte{ 0 });
+    rnrg(std::span(bytes), cppx::endianness_neutral);
+
+    random_number_range_generator_t par_rnrg(72);
+    std::vector<std::byte> par_bytes(container_size, std::byte{ 0 });
+    par_rnrg(std::span(par_bytes), cppx::endianness_neutral, std::execution::par);
+    ASSERT_TRUE(std::ranges::equal(par_bytes, bytes));
+
+    std::array<integer_t, 16> next_ints, par_next_ints;
+    rnrg(std::span(next_ints), cppx::endianness_neutral);
+    par_rnrg(std::span(par_next_ints), cppx::endianness_neutral, std::execution::par);
+    ASSERT_EQ(par_next_ints, next_ints);
+}
+
+TEST(xoroshiro128plus_range_engine_tests, rnrg_benchmark)
+{
+    random_number_range_generator_t rnrg;
+    rand::rnrg_benchmark benchmark;
+    const rand::rnrg_benchmark_result bm_res =
+        benchmark.compute(rnrg, rand::bit_balanced_uint64s::enumerators, 1024 * 1024 + 7);
+    std::cout << "AH: " << bm_res.average_homogeneous_byte_distribution_index << std::endl;
+    std::cout << "AU: " << bm_res.average_integer_uniqueness_index << std::endl;
+    std::cout << "AD: " << bm_res.average_execution_duration << std::endl;
+    ASSERT_GT(bm_res.average_homogeneous_byte_distribution_index, 0.99);
+    ASSERT_EQ(bm_res.average_integer_uniqueness_index, 1.);
+}
@@ -2,6 +2,7 @@
 #include <arba/rand/rng/xorshift_engine.hpp>
 #include <arba/rand/rnrg/rnrg_benchmark.hpp>
 #include <arba/rand/rnrg/xorshift_range_engine.hpp>
+#include <arba/rand/simd/simd_isa.hpp>
 
 #include <arba/cppx/policy/execution_policy.hpp>
 #include <gtest/gtest.h>
@@ -10,6 +11,8 @@
 #include <ranges>
 #include <vector>
 
+#include "each_simd_isa.hpp"
+
 using random_number_generator_t = rand::xorshift32_engine;
 
 TEST(xorshift32_range_engine_tests, constructor__positive_seed__ok)
@@ -216,6 +219,52 @@ TEST(xorshift32_range_engine_tests, generate_random_xorshift32__ints__ok)
     ASSERT_TRUE(std::ranges::equal(alpha_ints, beta_ints));
 }
 
+TEST(xorshift32_range_engine_tests, generate_random_bytes__each_simd_isa_specific__same_as_scalar)
+{
+    using random_number_range_generator_t = rand::xorshift32_range_engine<16>;
+    using integer_t = random_number_range_generator_t::integer_type;
+
+    generate_with_each_simd_isa<random_number_range_generator_t>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { rnrg(bytes, cppx::endianness_specific); }, integer_t(72));
+}
+
+TEST(xorshift32_range_engine_tests, generate_random_bytes__each_simd_isa_neutral__same_as_scalar)
+{
+    using random_number_range_generator_t = rand::xorshift32_range_engine<16>;
+    using integer_t = random_number_range_generator_t::integer_type;
+
+    generate_with_each_simd_isa<random_number_range_generator_t>(
+        1000 * sizeof(integer_t) + 3,
+        [](auto& rnrg, std::span<std::byte> bytes) { rnrg(bytes, cppx::endianness_neutral); }, integer_t(72));
+}
+
+TEST(xorshift32_range_engine_tests, generate_random_bytes__seq_and_par__same_bytes)
+{
+    using random_number_range_generator_t = rand::xorshift32_range_engine<>;
+    using integer_t = random_number_range_generator_t::integer_type;
+
+    const integer_t seed = 72;
+    const std::size_t container_size = 4 * random_number_range_generator_t::parallel_block_size * sizeof(integer_t) + 5;
+
+    random_number_range_generator_t rnrg(seed);
+    std::vector<std::byte> bytes(container_size, std::byte{ 0 });
+    rnrg(std::span(bytes), cppx::endianness_neutral);
+
+    random_number_range_generator_t seq_rnrg(seed);
+    std::vector<std::byte> seq_bytes(container_size, std::byte{ 0 });
+    seq_rnrg(std::span(seq_bytes), cppx::endianness_neutral, std::execution::seq);
+
+    random_number_range_generator_t par_rnrg(seed);
+    std::vector<std::byte> par_bytes(container_size, std::byte{ 0 });
+    par_rnrg(std::span(par_bytes), cppx::endianness_neutral, std::execution::par);
+
+    ASSERT_TRUE(std::ranges::equal(seq_bytes, bytes));
+    ASSERT_TRUE(std::ranges::equal(par_bytes, seq_bytes));
+    ASSERT_EQ(seq_rnrg.seed(), rnrg.seed());
+    ASSERT_EQ(par_rnrg.seed(), seq_rnrg.seed());
+}
+
 TEST(xorshift32_range_engine_tests, rnrg_benchmark)
 {
     using random_number_range_generator_t = rand::xorshift32_range_engine<>;
@@ -0,0 +1,174 @@
+#include <arba/rand/rng/splitmix64_engine.hpp>
+#include <arba/rand/statistical_tests.hpp>
+
+#include <arba/cppx/policy/execution_policy.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Bytes of the splitmix64 values of seed 42, each value in little-endian order.
+static std::vector<std::byte> splitmix64_bytes_(std::size_t nb_bytes)
+{
+    rand::splitmix64_engine rng(42);
+    std::vector<std::byte> bytes;
+    while (bytes.size() < nb_bytes)
+    {
+        const uint64_t value = rng();
+        for (unsigned i = 0; i < 8 && bytes.size() < nb_bytes; ++i)
+            bytes.push_back(std::byte(value >> (8 * i)));
+    }
+    return bytes;
+}
+
+static const std::vector<std::byte> random_bytes = splitmix64_bytes_(1024 * 1024 + 3);
+
+TEST(statistical_tests_tests, regularized_gamma__known_values__ok)
+{
+    EXPECT_NEAR(rand::private_::regularized_gamma_q_(1., 3.), std::exp(-3.), 1e-14);
+    EXPECT_NEAR(rand::private_::regularized_gamma_q_(0.5, 2.), std::erfc(std::sqrt(2.)), 1e-14);
+    EXPECT_NEAR(rand::private_::regularized_gamma_p_(0.5, 0.2), std::erf(std::sqrt(0.2)), 1e-14);
+    // Critical value of the chi-square distribution with 255 degrees of freedom at 5%.
+    EXPECT_NEAR(rand::private_::chi_square_p_value_(293.248, 255.), 0.05, 1e-4);
+    for (const double x : { 32'000., 32'767.5, 33'500. })
+    {
+        const double sum =
+            rand::private_::regularized_gamma_p_(32'767.5, x) + rand::private_::regularized_gamma_q_(32'767.5, x);
+        EXPECT_NEAR(sum, 1., 1e-12);
+    }
+    EXPECT_NEAR(rand::private_::chi_square_p_value_(65'535., 65'535.), 0.5, 0.01);
+}
+
+TEST(statistical_tests_tests, chi_square_bytes_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::chi_square_bytes_test(random_bytes, std::execution::seq);
+    EXPECT_NEAR(result.statistic, 230.50543545121542, 1e-9);
+    EXPECT_NEAR(result.p_value, rand::private_::chi_square_p_value_(result.statistic, 255.), 1e-15);
+    EXPECT_GT(result.p_value, 0.8);
+    EXPECT_LT(result.p_value, 0.9);
+}
+
+TEST(statistical_tests_tests, chi_square_words16_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::chi_square_words16_test(random_bytes, std::execution::seq);
+    EXPECT_NEAR(result.statistic, 65'766.99955749596, 1e-6);
+    EXPECT_GT(result.p_value, 0.2);
+    EXPECT_LT(result.p_value, 0.3);
+}
+
+TEST(statistical_tests_tests, monobit_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::monobit_test(random_bytes, std::execution::seq);
+    EXPECT_NEAR(result.statistic, 0.2886427848825194, 1e-12);
+    EXPECT_NEAR(result.p_value, std::erfc(0.2886427848825194 / std::sqrt(2.)), 1e-12);
+}
+
+TEST(statistical_tests_tests, runs_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::runs_test(random_bytes, std::execution::seq);
+    EXPECT_EQ(result.statistic, 4'196'218.);
+    EXPECT_GT(result.p_value, 0.01);
+}
+
+TEST(statistical_tests_tests, serial_correlation_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::serial_correlation_test(random_bytes, std::execution::seq);
+    EXPECT_NEAR(result.statistic, -0.00015652372603724792, 1e-15);
+    EXPECT_NEAR(result.p_value, std::erfc(0.00015652372603724792 * std::sqrt(1024. * 1024 + 3) / std::sqrt(2.)),
+                1e-12);
+}
+
+TEST(statistical_tests_tests, entropy_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::entropy_test(random_bytes, std::execution::seq);
+    EXPECT_NEAR(result.statistic, 7.999841482408378, 1e-12);
+    EXPECT_GT(result.p_value, 0.01);
+}
+
+TEST(statistical_tests_tests, gap_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::gap_test(random_bytes, std::execution::seq);
+    EXPECT_NEAR(result.statistic, 63.16860447912849, 1e-9);
+    EXPECT_GT(result.p_value, 0.4);
+    EXPECT_LT(result.p_value, 0.6);
+}
+
+TEST(statistical_tests_tests, gap_test__each_alignment__same_gaps)
+{
+    // Removing the bytes before the first hit keeps the gaps, while the hits move in the words read 8 bytes at a time.
+    std::size_t offset = 0;
+    while (!std::all_of(random_bytes.begin() + offset, random_bytes.begin() + offset + 9,
+                        [](std::byte byte) { return uint8_t(byte) >= 16; }))
+        ++offset;
+    const std::span bytes = std::span(random_bytes).subspan(offset);
+    const rand::statistical_test_result result = rand::gap_test(bytes, std::execution::seq);
+    for (std::size_t shift = 1; shift <= 9; ++shift)
+        EXPECT_EQ(rand::gap_test(bytes.subspan(shift), std::execution::seq).statistic, result.statistic) << shift;
+}
+
+TEST(statistical_tests_tests, birthday_spacings_test__random_bytes__ok)
+{
+    const rand::statistical_test_result result = rand::birthday_spacings_test(random_bytes, std::execution::seq);
+    EXPECT_EQ(result.statistic, 250.);
+    // P(X >= 250) for a Poisson variable of mean 64 * 4 = 256.
+    EXPECT_GT(result.p_value, 0.6);
+    EXPECT_LT(result.p_value, 0.7);
+}
+
+#ifdef ARBA_CPPX_EXECUTION_ALL_STD_POLICIES
+TEST(statistical_tests_tests, run_statistical_test__seq_and_par__same_results)
+{
+    const std::vector<std::byte> bytes = splitmix64_bytes_(70 * 1024 * 1024 + 5);
+    for (const rand::statistical_test test : rand::statistical_tests)
+    {
+        const rand::statistical_test_result seq_result = rand::run_statistical_test(test, bytes);
+        const rand::statistical_test_result par_result = rand::run_statistical_test(test, bytes, std::execution::par);
+        EXPECT_EQ(seq_result.statistic, par_result.statistic) << rand::to_string(test);
+        EXPECT_EQ(seq_result.p_value, par_result.p_value) << rand::to_string(test);
+        EXPECT_GT(seq_result.p_value, 0.001) << rand::to_string(test);
+        EXPECT_LT(seq_result.p_value, 0.999) << rand::to_string(test);
+    }
+}
+#endif
+
+TEST(statistical_tests_tests, run_statistical_test__zeros__rejected)
+{
+    const std::vector<std::byte> bytes(1024 * 1024, std::byte{ 0 });
+    EXPECT_EQ(rand::chi_square_bytes_test(bytes, std::execution::seq).p_value, 0.);
+    EXPECT_EQ(rand::monobit_test(bytes, std::execution::seq).p_value, 0.);
+    EXPECT_EQ(rand::runs_test(bytes, std::execution::seq).p_value, 0.);
+    EXPECT_EQ(rand::entropy_test(bytes, std::execution::seq).statistic, 0.);
+    EXPECT_EQ(rand::entropy_test(bytes, std::execution::seq).p_value, 0.);
+    EXPECT_EQ(rand::birthday_spacings_test(bytes, std::execution::seq).p_value, 0.);
+}
+
+TEST(statistical_tests_tests, run_statistical_test__patterns__rejected)
+{
+    std::vector<std::byte> counter_bytes(1024 * 1024);
+    for (std::size_t i = 0; i < counter_bytes.size(); ++i)
+        counter_bytes[i] = std::byte(i);
+    // Too uniform: a p-value of 1 rejects the sequence as well.
+    EXPECT_EQ(rand::chi_square_bytes_test(counter_bytes, std::execution::seq).p_value, 1.);
+    EXPECT_LT(rand::serial_correlation_test(counter_bytes, std::execution::seq).p_value, 1e-10);
+    EXPECT_LT(rand::gap_test(counter_bytes, std::execution::seq).p_value, 1e-10);
+
+    const std::vector<std::byte> alternating_bytes(1024 * 1024, std::byte{ 0x55 });
+    EXPECT_EQ(rand::monobit_test(alternating_bytes, std::execution::seq).p_value, 1.);
+    EXPECT_EQ(rand::runs_test(alternating_bytes, std::execution::seq).statistic, 8. * alternating_bytes.size());
+    EXPECT_EQ(rand::runs_test(alternating_bytes, std::execution::seq).p_value, 0.);
+}
+
+TEST(statistical_tests_tests, run_statistical_test__too_short__nan)
+{
+    const std::vector<std::byte> bytes = splitmix64_bytes_(1000);
+    EXPECT_TRUE(std::isnan(rand::chi_square_words16_test(bytes, std::execution::seq).p_value));
+    EXPECT_TRUE(std::isnan(rand::birthday_spacings_test(bytes, std::execution::seq).p_value));
+    EXPECT_TRUE(std::isnan(rand::gap_test(bytes, std::execution::seq).p_value));
+    // About 2000 gaps: enough for the cell of the gaps of 64 bytes or more, not for the one of the gaps of 63 bytes.
+    EXPECT_TRUE(std::isnan(rand::gap_test(splitmix64_bytes_(32 * 1024), std::execution::seq).p_value));
+    EXPECT_FALSE(std::isnan(rand::gap_test(splitmix64_bytes_(128 * 1024), std::execution::seq).p_value));
+    EXPECT_TRUE(std::isnan(rand::monobit_test(std::span<const std::byte>(), std::execution::seq).p_value));
+}
@@ -0,0 +1,34 @@
+#include <arba/rand/threefry.hpp>
+
+#include <gtest/gtest.h>
+
+// Known-answer vectors of Random123 (kat_vectors, threefry2x64 13 and 20 rounds).
+
+static_assert(rand::threefry2x64({ 0, 0 }, { 0, 0 })[0] == 0xc2b6e3a8c2c69865ull);
+
+TEST(threefry_tests, threefry2x64__kat_zeros__ok)
+{
+    EXPECT_EQ(rand::threefry2x64<13>({ 0, 0 }, { 0, 0 }),
+              (rand::threefry2x64_counter{ 0xf167b032c3b480bdull, 0xe91f9fee4b7a6fb5ull }));
+    EXPECT_EQ(rand::threefry2x64({ 0, 0 }, { 0, 0 }),
+              (rand::threefry2x64_counter{ 0xc2b6e3a8c2c69865ull, 0x6f81ed42f350084dull }));
+}
+
+TEST(threefry_tests, threefry2x64__kat_ones__ok)
+{
+    constexpr uint64_t ones = 0xffffffffffffffffull;
+    EXPECT_EQ(rand::threefry2x64<13>({ ones, ones }, { ones, ones }),
+              (rand::threefry2x64_counter{ 0xccdec5c917a874b1ull, 0x4df53abca26ceb01ull }));
+    EXPECT_EQ(rand::threefry2x64({ ones, ones }, { ones, ones }),
+              (rand::threefry2x64_counter{ 0xe02cb7c4d95d277aull, 0xd06633d0893b8b68ull }));
+}
+
+TEST(threefry_tests, threefry2x64__kat_pi__ok)
+{
+    const rand::threefry2x64_counter counter = { 0x243f6a8885a308d3ull, 0x13198a2e03707344ull };
+    const rand::threefry2x64_key key = { 0xa4093822299f31d0ull, 0x082efa98ec4e6c89ull };
+    EXPECT_EQ(rand::threefry2x64<13>(counter, key),
+              (rand::threefry2x64_counter{ 0xc3aac71561042993ull, 0x3fe7ae8801aff316ull }));
+    EXPECT_EQ(rand::threefry2x64(counter, key),
+              (rand::threefry2x64_counter{ 0x263c7d30bb0f0af1ull, 0x56be8361d3311526ull }));
+}
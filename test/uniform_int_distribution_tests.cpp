@@ -0,0 +1,175 @@
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/uniform_int_distribution.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <sstream>
+
+template <std::integral IntType, std::uniform_random_bit_generator UrngT>
+void check_bounds_(UrngT& rng, IntType min, IntType max)
+{
+    rand::uniform_int_distribution<IntType> distribution(min, max);
+    ASSERT_EQ(distribution.a(), min);
+    ASSERT_EQ(distribution.b(), max);
+    for (unsigned times = 10'000; times; --times)
+    {
+        const IntType value = distribution(rng);
+        ASSERT_GE(value, min);
+        ASSERT_LE(value, max);
+    }
+}
+
+TEST(uniform_int_distribution_tests, operator_call__bounds__ok)
+{
+    rand::xorshift64_engine rng(42);
+    check_bounds_<int8_t>(rng, -100, 27);
+    check_bounds_<uint8_t>(rng, 3, 3);
+    check_bounds_<int16_t>(rng, -1000, -10);
+    check_bounds_<uint16_t>(rng, 1, 60'000);
+    check_bounds_<int32_t>(rng, std::numeric_limits<int32_t>::min(), 0);
+    check_bounds_<uint32_t>(rng, 7, 1'000'000'007);
+    check_bounds_<int64_t>(rng, -5'000'000'000'000ll, 5'000'000'000'000ll);
+    check_bounds_<uint64_t>(rng, 1, std::numeric_limits<uint64_t>::max() / 3 * 2);
+}
+
+TEST(uniform_int_distribution_tests, operator_call__full_range__ok)
+{
+    rand::xorshift64_engine rng(42);
+    rand::xorshift64_engine rng_2(42);
+    rand::uniform_int_distribution<uint64_t> distribution;
+    ASSERT_EQ(distribution(rng), rng_2());
+    check_bounds_<int64_t>(rng, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+    check_bounds_<int8_t>(rng, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+}
+
+TEST(uniform_int_distribution_tests, operator_call__32_bits_urng__ok)
+{
+    std::mt19937 rng(42);
+    check_bounds_<uint16_t>(rng, 1, 255);
+    check_bounds_<uint64_t>(rng, 1, 1ull << 40);
+    check_bounds_<int64_t>(rng, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+}
+
+TEST(uniform_int_distribution_tests, operator_call__not_full_range_urng__ok)
+{
+    std::minstd_rand rng(42);
+    check_bounds_<uint16_t>(rng, 1, 255);
+    check_bounds_<int64_t>(rng, -7, 1ll << 40);
+}
+
+TEST(uniform_int_distribution_tests, operator_call__distribution__balanced)
+{
+    rand::xorshift32_engine rng(42);
+    rand::uniform_int_distribution<uint16_t> distribution(1, 255);
+
+    std::array<unsigned, 256> counters{ 0 };
+    constexpr unsigned factor = 1000;
+    for (unsigned times = (counters.size() - 1) * factor; times; --times)
+        ++counters.at(distribution(rng));
+
+    EXPECT_EQ(counters.front(), 0);
+    std::ranges::for_each(std::ranges::subrange(counters.begin() + 1, counters.end()),
+                          [=](const auto& counter) { EXPECT_GE(counter, 0.9 * factor); });
+}
+
+TEST(uniform_int_distribution_tests, multiply_wide__max_values__ok)
+{
+    constexpr uint64_t max = std::numeric_limits<uint64_t>::max();
+    const rand::private_::wide_product_<uint64_t> product = rand::private_::multiply_wide_<uint64_t>(max, max);
+    EXPECT_EQ(product.high, max - 1);
+    EXPECT_EQ(product.low, 1u);
+    const rand::private_::wide_product_<uint64_t> product_2 =
+        rand::private_::multiply_wide_<uint64_t>(0x0123'4567'89ab'cdefull, 0xfedc'ba98'7654'3210ull);
+    EXPECT_EQ(product_2.high, 0x0121'fa00'ad77'd742ull);
+    EXPECT_EQ(product_2.low, 0x2236'd88f'e561'8cf0ull);
+    const rand::private_::wide_product_<uint32_t> product_3 = rand::private_::multiply_wide_<uint32_t>(0xffff'ffffu, 3);
+    EXPECT_EQ(product_3.high, 2u);
+    EXPECT_EQ(product_3.low, 0xffff'fffdu);
+}
+
+TEST(uniform_int_distribution_tests, param__set__same_as_constructed)
+{
+    using distribution_t = rand::uniform_int_distribution<int64_t>;
+
+    distribution_t distribution;
+    distribution.param(distribution_t::param_type(-7, 1'000));
+    EXPECT_EQ(distribution.param(), distribution_t::param_type(-7, 1'000));
+    EXPECT_EQ(distribution, distribution_t(-7, 1'000));
+    EXPECT_EQ(distribution, distribution_t(distribution_t::param_type(-7, 1'000)));
+
+    rand::xorshift64_engine rng(42);
+    rand::xorshift64_engine rng_2(42);
+    const distribution_t other_distribution(5, 10);
+    for (unsigned times = 1'000; times; --times)
+        ASSERT_EQ(other_distribution(rng, distribution.param()), distribution(rng_2));
+}
+
+TEST(uniform_int_distribution_tests, stream_operators__a_b__same_distribution)
+{
+    const rand::uniform_int_distribution<int8_t> distribution(-100, 27);
+    std::stringstream stream;
+    stream << std::hex << distribution;
+    EXPECT_EQ(stream.str(), "-100 27");
+    EXPECT_TRUE(stream.flags() & std::ios_base::hex);
+
+    rand::uniform_int_distribution<int8_t> read_distribution;
+    stream >> read_distribution;
+    ASSERT_FALSE(stream.fail());
+    EXPECT_EQ(read_distribution, distribution);
+}
+
+#ifdef __GLIBCXX__
+template <std::integral IntType, std::uniform_random_bit_generator UrngT>
+void check_same_as_std_(IntType min, IntType max)
+{
+    UrngT rng(42);
+    UrngT std_rng(42);
+    rand::uniform_int_distribution<IntType> distribution(min, max);
+    std::uniform_int_distribution<IntType> std_distribution(min, max);
+    for (unsigned times = 10'000; times; --times)
+        ASSERT_EQ(distribution(rng), std_distribution(std_rng));
+    // The standard library writes the values of the char types as characters.
+    if constexpr (sizeof(IntType) > 1)
+    {
+        std::ostringstream stream, std_stream;
+        stream << distribution;
+        std_stream << std_distribution;
+        ASSERT_EQ(stream.str(), std_stream.str());
+    }
+}
+
+template <std::uniform_random_bit_generator UrngT>
+void check_same_as_std_for_each_int_type_()
+{
+    check_same_as_std_<int8_t, UrngT>(-100, 27);
+    check_same_as_std_<uint8_t, UrngT>(0, std::numeric_limits<uint8_t>::max());
+    check_same_as_std_<int16_t, UrngT>(-1000, -10);
+    check_same_as_std_<uint16_t, UrngT>(1, 60'000);
+    check_same_as_std_<int32_t, UrngT>(0, 100);
+    check_same_as_std_<int32_t, UrngT>(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+    check_same_as_std_<uint32_t, UrngT>(7, 1'000'000'007);
+    check_same_as_std_<int64_t, UrngT>(0, 100);
+    check_same_as_std_<int64_t, UrngT>(-5, std::numeric_limits<uint32_t>::max() - 5);
+    check_same_as_std_<int64_t, UrngT>(-5'000'000'000'000ll, 5'000'000'000'000ll);
+    check_same_as_std_<int64_t, UrngT>(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+    check_same_as_std_<uint64_t, UrngT>(0, 1ull << 40);
+    check_same_as_std_<uint64_t, UrngT>(1, std::numeric_limits<uint64_t>::max() / 3 * 2);
+}
+
+// libstdc++ uses the same method: the sequences are the ones of std::uniform_int_distribution.
+TEST(uniform_int_distribution_tests, operator_call__32_bits_urng__same_as_libstdcxx)
+{
+    check_same_as_std_for_each_int_type_<std::mt19937>();
+    check_same_as_std_for_each_int_type_<rand::xorshift32_engine>();
+}
+
+TEST(uniform_int_distribution_tests, operator_call__64_bits_urng__same_as_libstdcxx)
+{
+    check_same_as_std_for_each_int_type_<std::mt19937_64>();
+    check_same_as_std_for_each_int_type_<rand::xorshift64_engine>();
+}
+#endif
@@ -0,0 +1,46 @@
+#include <arba/rand/xorshift_jump.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+static_assert(rand::xorshift32_jump(42, 0) == 42);
+static_assert(rand::xorshift64_jump(42, 1) == rand::xorshift64(42));
+
+TEST(xorshift_jump_tests, xorshift32_jump__n__same_as_n_steps)
+{
+    uint32_t value = 0x11121314;
+    for (unsigned long long n = 0; n < 1000; ++n, value = rand::xorshift32(value))
+        ASSERT_EQ(rand::xorshift32_jump(0x11121314, n), value);
+}
+
+TEST(xorshift_jump_tests, xorshift64_jump__n__same_as_n_steps)
+{
+    uint64_t value = 0x11121314;
+    for (unsigned long long n = 0; n < 1000; ++n, value = rand::xorshift64(value))
+        ASSERT_EQ(rand::xorshift64_jump(0x11121314, n), value);
+}
+
+TEST(xorshift_jump_tests, xorshift32_jump__period__ok)
+{
+    const uint32_t value = 0x11121314;
+    EXPECT_EQ(rand::xorshift32_jump(value, std::numeric_limits<uint32_t>::max()), value);
+    EXPECT_EQ(rand::xorshift32_jump(value, std::numeric_limits<uint32_t>::max() + 5ull), rand::xorshift32_jump(value, 5));
+    EXPECT_EQ(rand::xorshift32_jump(0, 1'000'000), 0);
+}
+
+TEST(xorshift_jump_tests, xorshift64_jump__period__ok)
+{
+    const uint64_t value = 0x11121314;
+    EXPECT_EQ(rand::xorshift64_jump(value, std::numeric_limits<uint64_t>::max()), value);
+    EXPECT_EQ(rand::xorshift64_jump(0, 1'000'000), 0);
+}
+
+TEST(xorshift_jump_tests, xorshift64_jump__composition__ok)
+{
+    const uint64_t value = 0x11121314;
+    const unsigned long long a = 1ull << 40;
+    const unsigned long long b = 123'456'789'012ull;
+    EXPECT_EQ(rand::xorshift64_jump(rand::xorshift64_jump(value, a), b), rand::xorshift64_jump(value, a + b));
+    EXPECT_EQ(rand::xorshift64(rand::xorshift64_jump(value, a)), rand::xorshift64_jump(value, a + 1));
+}
@@ -0,0 +1,100 @@
+#include <arba/rand/xoshiro.hpp>
+#include <arba/rand/xoshiro_jump.hpp>
+
+#include <gtest/gtest.h>
+
+// Reference values computed with the C implementations of the authors (xoshiro256starstar.c, xoroshiro128plus.c,
+// splitmix64.c).
+
+TEST(xoshiro_tests, xoshiro256ss__reference_vector__ok)
+{
+    rand::xoshiro256_state state = { 1, 2, 3, 4 };
+    EXPECT_EQ(rand::xoshiro256ss(state), 11'520ull);
+    EXPECT_EQ(rand::xoshiro256ss(state), 0ull);
+    EXPECT_EQ(rand::xoshiro256ss(state), 1'509'978'240ull);
+    EXPECT_EQ(rand::xoshiro256ss(state), 1'215'971'899'390'074'240ull);
+    EXPECT_EQ(rand::xoshiro256ss(state), 1'216'172'134'540'287'360ull);
+    EXPECT_EQ(rand::xoshiro256ss(state), 607'988'272'756'665'600ull);
+}
+
+TEST(xoshiro_tests, xoroshiro128plus__reference_vector__ok)
+{
+    rand::xoroshiro128_state state = { 1, 2 };
+    EXPECT_EQ(rand::xoroshiro128plus(state), 3ull);
+    EXPECT_EQ(rand::xoroshiro128plus(state), 412'333'834'243ull);
+    EXPECT_EQ(rand::xoroshiro128plus(state), 2'360'170'716'294'286'339ull);
+    EXPECT_EQ(rand::xoroshiro128plus(state), 9'295'852'285'959'843'169ull);
+    EXPECT_EQ(rand::xoroshiro128plus(state), 2'797'080'929'874'688'578ull);
+    EXPECT_EQ(rand::xoroshiro128plus(state), 6'019'711'933'173'041'966ull);
+}
+
+TEST(xoshiro_tests, seed_state__splitmix64__ok)
+{
+    static_assert(rand::xoshiro256_seed_state(0)[0] == 0xe220a8397b1dcdafull);
+    static_assert(rand::xoroshiro128_seed_state(0)[0] == 0xe220a8397b1dcdafull);
+
+    const rand::xoshiro256_state state = rand::xoshiro256_seed_state(42);
+    EXPECT_EQ(state[0], 0xbdd732262feb6e95ull);
+    EXPECT_EQ(state[1], 0x28efe333b266f103ull);
+    EXPECT_EQ(state[2], 0x47526757130f9f52ull);
+    EXPECT_EQ(state[3], 0x581ce1ff0e4ae394ull);
+    const rand::xoroshiro128_state state_2 = rand::xoroshiro128_seed_state(42);
+    EXPECT_EQ(state_2[0], state[0]);
+    EXPECT_EQ(state_2[1], state[1]);
+}
+
+// The values after the jumps were checked against the powers 2^k of the transition matrices over GF(2).
+
+TEST(xoshiro_tests, xoshiro256_jump__seed_42__ok)
+{
+    rand::xoshiro256_state state = rand::xoshiro256_jump(rand::xoshiro256_seed_state(42));
+    EXPECT_EQ(rand::xoshiro256ss(state), 5'766'981'335'298'035'530ull);
+    state = rand::xoshiro256_long_jump(rand::xoshiro256_seed_state(42));
+    EXPECT_EQ(rand::xoshiro256ss(state), 11'575'600'654'643'926'073ull);
+}
+
+TEST(xoshiro_tests, xoroshiro128_jump__seed_42__ok)
+{
+    rand::xoroshiro128_state state = rand::xoroshiro128_jump(rand::xoroshiro128_seed_state(42));
+    EXPECT_EQ(rand::xoroshiro128plus(state), 5'705'470'370'475'506'813ull);
+    state = rand::xoroshiro128_long_jump(rand::xoroshiro128_seed_state(42));
+    EXPECT_EQ(rand::xoroshiro128plus(state), 13'306'053'053'574'487'685ull);
+}
+
+TEST(xoshiro_tests, jump__commutes_with_next__ok)
+{
+    rand::xoshiro256_state state = rand::xoshiro256_seed_state(7);
+    rand::xoshiro256_state jumped_state = rand::xoshiro256_jump(state);
+    rand::xoshiro256ss(state);
+    rand::xoshiro256ss(jumped_state);
+    EXPECT_EQ(rand::xoshiro256_jump(state), jumped_state);
+}
+
+static_assert(rand::xoroshiro128_jump(rand::xoroshiro128_state{ 1, 2 }, 0) == rand::xoroshiro128_state{ 1, 2 });
+
+TEST(xoshiro_tests, jump__n__same_as_n_steps)
+{
+    rand::xoshiro256_state state = rand::xoshiro256_seed_state(42);
+    rand::xoroshiro128_state state_2 = rand::xoroshiro128_seed_state(42);
+    for (unsigned long long n = 0; n < 1000; ++n, rand::xoshiro256ss(state), rand::xoroshiro128plus(state_2))
+    {
+        ASSERT_EQ(rand::xoshiro256_jump(rand::xoshiro256_seed_state(42), n), state) << n;
+        ASSERT_EQ(rand::xoroshiro128_jump(rand::xoroshiro128_seed_state(42), n), state_2) << n;
+    }
+}
+
+TEST(xoshiro_tests, jump__n__same_as_jump_polynomial)
+{
+    const rand::xoroshiro128_state state = rand::xoroshiro128_seed_state(42);
+    EXPECT_EQ(rand::xoroshiro128_jump(rand::xoroshiro128_jump(state, 1ull << 63), 1ull << 63),
+              rand::xoroshiro128_jump(state));
+}
+
+TEST(xoshiro_tests, jump__composition__ok)
+{
+    const rand::xoshiro256_state state = rand::xoshiro256_seed_state(42);
+    const unsigned long long times = 0x0123'4567'89ab'cdefull;
+    const rand::xoshiro256_state jumped_state = rand::xoshiro256_jump(state, times);
+    EXPECT_EQ(rand::xoshiro256_jump(jumped_state, 1000), rand::xoshiro256_jump(state, times + 1000));
+    EXPECT_EQ(rand::xoshiro256_jump(jumped_state, times), rand::xoshiro256_jump(state, 2 * times));
+}
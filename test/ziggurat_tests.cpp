@@ -0,0 +1,51 @@
+#include <arba/rand/ziggurat.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+TEST(ziggurat_tests, constexpr_math__ok)
+{
+    static_assert(rand::private_::constexpr_exp_(0.) == 1.);
+    static_assert(rand::private_::constexpr_log_(1.) == 0.);
+    static_assert(rand::private_::constexpr_sqrt_(4.) == 2.);
+    for (double x : { -20., -6.5, -0.3, 0.7, 3. })
+        EXPECT_NEAR(rand::private_::constexpr_exp_(x), std::exp(x), std::exp(x) * 1e-15);
+    for (double x : { 1e-9, 0.00123, 0.5, 0.99, 7. })
+        EXPECT_NEAR(rand::private_::constexpr_log_(x), std::log(x), std::abs(std::log(x)) * 1e-15);
+    for (double x : { 2e-5, 0.5, 3., 1e9 })
+        EXPECT_NEAR(rand::private_::constexpr_sqrt_(x), std::sqrt(x), std::sqrt(x) * 1e-15);
+}
+
+template <class ZigguratT>
+void check_tables_()
+{
+    constexpr const rand::private_::ziggurat_tables_& tables = rand::private_::ziggurat_tables_v_<ZigguratT>;
+    static_assert(tables.x[1] == ZigguratT::r);
+    static_assert(tables.x[256] == 0);
+    EXPECT_NEAR(tables.x[0] * tables.f[1], ZigguratT::v, 1e-15);
+    for (std::size_t i = 1; i < 256; ++i)
+    {
+        ASSERT_GT(tables.x[i], tables.x[i + 1]);
+        ASSERT_NEAR(tables.x[i] * (tables.f[i + 1] - tables.f[i]), ZigguratT::v, 1e-11);
+    }
+}
+
+TEST(ziggurat_tables_tests, normal_tables__ok)
+{
+    check_tables_<rand::private_::ziggurat_normal_>();
+    // Reference values of Marsaglia and Tsang's 256 layers.
+    constexpr const rand::private_::ziggurat_tables_& tables =
+        rand::private_::ziggurat_tables_v_<rand::private_::ziggurat_normal_>;
+    EXPECT_NEAR(tables.x[0], 3.910757959537090045, 1e-14);
+    EXPECT_NEAR(tables.x[2], 3.449278298560964462, 1e-14);
+}
+
+TEST(ziggurat_tables_tests, exponential_tables__ok)
+{
+    check_tables_<rand::private_::ziggurat_exponential_>();
+    constexpr const rand::private_::ziggurat_tables_& tables =
+        rand::private_::ziggurat_tables_v_<rand::private_::ziggurat_exponential_>;
+    EXPECT_NEAR(tables.x[0], 8.697117470131052741, 1e-14);
+    EXPECT_NEAR(tables.x[2], 6.941033629377212577, 1e-14);
+}
@@ -0,0 +1,411 @@
+// Streams the bytes of a range engine to the standard output, to feed external test batteries:
+//   rnrg_stream xoron64_range_engine --seed pi_rdigits | RNG_test stdin64
+//   rnrg_stream chacha_range_engine --bytes 1G > chacha.bin
+// The bytes are generated in a background thread while the previous block is written (double buffering), with large
+// write() calls, so that the tool is never the bottleneck of the pipe. Each block is a request to the engine: the
+// stream of a seed is reproducible for a given block size, but most range engines give other bytes for another one.
+
+#include <arba/rand/bit_balanced_uints.hpp>
+#include <arba/rand/rng/pcg_engine.hpp>
+#include <arba/rand/rng/romu_engine.hpp>
+#include <arba/rand/rng/sfc64_engine.hpp>
+#include <arba/rand/rng/splitmix64_engine.hpp>
+#include <arba/rand/rng/wyrand_engine.hpp>
+#include <arba/rand/rng/xorshift_engine.hpp>
+#include <arba/rand/rng/xoshiro_engine.hpp>
+#include <arba/rand/rnrg/chacha_range_engine.hpp>
+#include <arba/rand/rnrg/counter_based_range_engine.hpp>
+#include <arba/rand/rnrg/urng_range_engine.hpp>
+#include <arba/rand/rnrg/xoron32_range_engine.hpp>
+#include <arba/rand/rnrg/xoron64_range_engine.hpp>
+#include <arba/rand/rnrg/xorshift_range_engine.hpp>
+#include <arba/rand/rnrg/xoshiro_range_engine.hpp>
+
+#include <arba/cppx/policy/endianness_policy.hpp>
+#include <arba/cppx/policy/execution_policy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <random>
+#include <semaphore>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<unistd.h>)
+#include <csignal>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace
+{
+
+struct stream_options
+{
+    // Name of a bit balanced integer of the width of the seed of the engine, or an integer (the first name when empty).
+    std::string_view seed;
+    // 0 for an endless stream.
+    std::size_t nb_bytes = 0;
+    std::size_t block_size = 16 * 1024 * 1024;
+    bool neutral_endianness = false;
+    bool parallel = false;
+    bool verbose = false;
+};
+
+// Writes all the bytes to the standard output: false when the reader has closed the pipe, or on error.
+bool write_bytes(std::span<const std::byte> bytes)
+{
+#if __has_include(<unistd.h>)
+    while (!bytes.empty())
+    {
+        const ssize_t nb_written = ::write(STDOUT_FILENO, bytes.data(), bytes.size());
+        if (nb_written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno != EPIPE)
+                std::perror("rnrg_stream: write");
+            return false;
+        }
+        bytes = bytes.subspan(std::size_t(nb_written));
+    }
+    return true;
+#else
+    return std::fwrite(bytes.data(), 1, bytes.size(), stdout) == bytes.size();
+#endif
+}
+
+// Generates the blocks in a background thread while the main thread writes the other buffer.
+template <class RnrgT>
+std::size_t stream(RnrgT& rnrg, const stream_options& options, cppx::EndiannessPolicy auto endianness_policy,
+                   cppx::ExecutionPolicy auto execution_policy)
+{
+    struct buffer
+    {
+        std::unique_ptr<std::byte[]> bytes;
+        std::size_t size = 0;
+        std::binary_semaphore filled{ 0 };
+        std::binary_semaphore emptied{ 1 };
+    };
+    std::array<buffer, 2> buffers;
+    for (buffer& block : buffers)
+        block.bytes = std::make_unique_for_overwrite<std::byte[]>(options.block_size);
+    std::atomic<bool> stopped = false;
+
+    // An empty block ends the stream.
+    std::jthread producer(
+        [&]
+        {
+            std::size_t remaining_bytes = options.nb_bytes == 0 ? std::numeric_limits<std::size_t>::max()
+                                                                : options.nb_bytes;
+            for (std::size_t index = 0;; index ^= 1)
+            {
+                buffer& block = buffers[index];
+                block.emptied.acquire();
+                if (stopped.load(std::memory_order_relaxed))
+                    return;
+                block.size = std::min(options.block_size, remaining_bytes);
+                remaining_bytes -= block.size;
+                const std::span bytes(block.bytes.get(), block.size);
+                if constexpr (requires { rnrg(bytes, endianness_policy, execution_policy); })
+                    rnrg(bytes, endianness_policy, execution_policy);
+                else
+                    rnrg(bytes, endianness_policy);
+                block.filled.release();
+                if (bytes.empty())
+                    return;
+            }
+        });
+
+    std::size_t nb_written_bytes = 0;
+    for (std::size_t index = 0;; index ^= 1)
+    {
+        buffer& block = buffers[index];
+        block.filled.acquire();
+        const bool written = block.size > 0 && write_bytes(std::span(block.bytes.get(), block.size));
+        if (written)
+            nb_written_bytes += block.size;
+        else
+            stopped.store(true, std::memory_order_relaxed);
+        // The producer waits on this buffer once it has filled the other one.
+        block.emptied.release();
+        if (!written)
+            return nb_written_bytes;
+    }
+}
+
+// Type of the seed of an engine: the one returned by its seed() (uint64_t for pcg32_engine, wider than its values),
+// else uint64_t, the seed of the keyed engines (chacha, philox, threefry) and of std::mt19937_64.
+template <class EngineT>
+struct engine_seed
+{
+    using type = uint64_t;
+};
+
+template <class EngineT>
+    requires requires(const EngineT& engine) { engine.seed(); }
+struct engine_seed<EngineT>
+{
+    using type = decltype(std::declval<const EngineT&>().seed());
+};
+
+template <class UrngT>
+struct engine_seed<rand::urng_range_engine<UrngT>> : engine_seed<UrngT>
+{
+};
+
+template <class SeedT>
+std::optional<SeedT> parse_seed(std::string_view str);
+
+template <class RnrgT>
+int stream_engine(const stream_options& options)
+{
+    using seed_type = typename engine_seed<RnrgT>::type;
+    const std::optional<seed_type> seed = parse_seed<seed_type>(options.seed);
+    if (!seed)
+    {
+        std::cerr << "rnrg_stream: invalid seed '" << options.seed << "' for an engine taking a "
+                  << 8 * sizeof(seed_type) << "-bit seed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    RnrgT rnrg;
+    rnrg.seed(*seed);
+
+    const auto start_time_point = std::chrono::steady_clock::now();
+    std::size_t nb_bytes = 0;
+    const auto stream_with = [&](auto endianness_policy)
+    {
+        nb_bytes = options.parallel ? stream(rnrg, options, endianness_policy, std::execution::par)
+                                    : stream(rnrg, options, endianness_policy, std::execution::seq);
+    };
+    if (options.neutral_endianness)
+        stream_with(cppx::endianness_neutral);
+    else
+        stream_with(cppx::endianness_specific);
+
+    if (options.verbose)
+    {
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start_time_point;
+        std::cerr << "rnrg_stream: " << nb_bytes << " bytes in " << duration.count() << " s ("
+                  << nb_bytes / duration.count() / 1e9 << " GB/s)" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
+
+struct engine_entry
+{
+    std::string_view name;
+    int (*stream)(const stream_options&);
+};
+
+// The scalar engines write their values in sequence through urng_range_engine.
+constexpr std::array engines = {
+    engine_entry{ "xorshift32_range_engine", &stream_engine<rand::xorshift32_range_engine<>> },
+    engine_entry{ "xorshift64_range_engine", &stream_engine<rand::xorshift64_range_engine<>> },
+    engine_entry{ "xoron32_range_engine", &stream_engine<rand::xoron32_range_engine<>> },
+    engine_entry{ "xoron64_range_engine", &stream_engine<rand::xoron64_range_engine<>> },
+    engine_entry{ "xoshiro256ss_range_engine", &stream_engine<rand::xoshiro256ss_range_engine<>> },
+    engine_entry{ "xoroshiro128plus_range_engine", &stream_engine<rand::xoroshiro128plus_range_engine<>> },
+    engine_entry{ "philox4x32_range_engine", &stream_engine<rand::philox4x32_range_engine<>> },
+    engine_entry{ "threefry2x64_range_engine", &stream_engine<rand::threefry2x64_range_engine<>> },
+    engine_entry{ "chacha_range_engine", &stream_engine<rand::chacha_range_engine<>> },
+    engine_entry{ "chacha12_range_engine", &stream_engine<rand::chacha_range_engine<12>> },
+    engine_entry{ "chacha8_range_engine", &stream_engine<rand::chacha_range_engine<8>> },
+    engine_entry{ "xorshift32_engine", &stream_engine<rand::urng_range_engine<rand::xorshift32_engine>> },
+    engine_entry{ "xorshift64_engine", &stream_engine<rand::urng_range_engine<rand::xorshift64_engine>> },
+    engine_entry{ "xoshiro256ss_engine", &stream_engine<rand::urng_range_engine<rand::xoshiro256ss_engine>> },
+    engine_entry{ "xoroshiro128plus_engine",
+                  &stream_engine<rand::urng_range_engine<rand::xoroshiro128plus_engine>> },
+    engine_entry{ "splitmix64_engine", &stream_engine<rand::urng_range_engine<rand::splitmix64_engine>> },
+    engine_entry{ "wyrand_engine", &stream_engine<rand::urng_range_engine<rand::wyrand_engine>> },
+    engine_entry{ "sfc64_engine", &stream_engine<rand::urng_range_engine<rand::sfc64_engine>> },
+    engine_entry{ "romu_trio_engine", &stream_engine<rand::urng_range_engine<rand::romu_trio_engine>> },
+    engine_entry{ "romu_duo_jr_engine", &stream_engine<rand::urng_range_engine<rand::romu_duo_jr_engine>> },
+    engine_entry{ "pcg32_engine", &stream_engine<rand::urng_range_engine<rand::pcg32_engine>> },
+    engine_entry{ "pcg64_engine", &stream_engine<rand::urng_range_engine<rand::pcg64_engine>> },
+    engine_entry{ "pcg64_dxsm_engine", &stream_engine<rand::urng_range_engine<rand::pcg64_dxsm_engine>> },
+    engine_entry{ "mt19937_64", &stream_engine<rand::urng_range_engine<std::mt19937_64>> },
+};
+
+void print_usage()
+{
+    std::cerr << "usage: rnrg_stream <engine> [options]\n"
+                 "  --seed <name|integer>      name of a bit_balanced_uint64s enumerator (bit_balanced_uint32s for\n"
+                 "                             the engines taking a 32-bit seed), or a decimal or 0x integer fitting\n"
+                 "                             in the seed (default: "
+              << rand::bit_balanced_uint64s::enumerator_names.front()
+              << ")\n"
+                 "  --bytes <size>             number of bytes to stream, with an optional K, M or G suffix\n"
+                 "                             (default: 0, endless)\n"
+                 "  --block-size <size>        size of each of the two buffers, a multiple of 8 (default: 16M)\n"
+                 "  --endianness <specific|neutral>\n"
+                 "  --par                      generates each block with std::execution::par\n"
+                 "  --verbose                  prints the throughput to the standard error at the end\n"
+                 "  --list                     prints the engines and the seed names\n";
+}
+
+std::optional<uint64_t> parse_integer(std::string_view str)
+{
+    int base = 10;
+    if (str.starts_with("0x") || str.starts_with("0X"))
+    {
+        str.remove_prefix(2);
+        base = 16;
+    }
+    uint64_t value = 0;
+    const auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), value, base);
+    if (error != std::errc() || end != str.data() + str.size() || str.empty())
+        return std::nullopt;
+    return value;
+}
+
+template <class SeedT>
+std::optional<SeedT> parse_seed(std::string_view str)
+{
+    using enumeration_type =
+        std::conditional_t<std::is_same_v<SeedT, uint64_t>, rand::bit_balanced_uint64s, rand::bit_balanced_uint32s>;
+    if (str.empty())
+        return enumeration_type::enumerators.front().value();
+    const auto& names = enumeration_type::enumerator_names;
+    if (const auto iter = std::ranges::find(names, str); iter != names.end())
+        return enumeration_type::enumerators[std::size_t(iter - names.begin())].value();
+    const std::optional<uint64_t> value = parse_integer(str);
+    if (!value || *value > std::numeric_limits<SeedT>::max())
+        return std::nullopt;
+    return SeedT(*value);
+}
+
+std::optional<std::size_t> parse_size(std::string_view str)
+{
+    std::size_t factor = 1;
+    if (!str.empty())
+    {
+        switch (str.back())
+        {
+        case 'K':
+        case 'k':
+            factor = 1024;
+            break;
+        case 'M':
+        case 'm':
+            factor = 1024 * 1024;
+            break;
+        case 'G':
+        case 'g':
+            factor = 1024 * 1024 * 1024;
+            break;
+        default:
+            break;
+        }
+    }
+    if (factor != 1)
+        str.remove_suffix(1);
+    const std::optional<uint64_t> value = parse_integer(str);
+    if (!value || *value > std::numeric_limits<std::size_t>::max() / factor)
+        return std::nullopt;
+    return std::size_t(*value * factor);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::span<char*> args(argv + 1, std::size_t(argc - 1));
+    if (args.empty())
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+    if (std::string_view(args.front()) == "--list")
+    {
+        std::cout << "engines:" << std::endl;
+        for (const engine_entry& engine : engines)
+            std::cout << "  " << engine.name << std::endl;
+        std::cout << "64-bit seeds:" << std::endl;
+        for (const std::string_view name : rand::bit_balanced_uint64s::enumerator_names)
+            std::cout << "  " << name << std::endl;
+        std::cout << "32-bit seeds:" << std::endl;
+        for (const std::string_view name : rand::bit_balanced_uint32s::enumerator_names)
+            std::cout << "  " << name << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::string_view engine_name = args.front();
+    const auto engine_iter = std::ranges::find(engines, engine_name, &engine_entry::name);
+    if (engine_iter == engines.end())
+    {
+        std::cerr << "rnrg_stream: unknown engine '" << engine_name << "' (see --list)" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    stream_options options;
+    for (std::size_t i = 1; i < args.size(); ++i)
+    {
+        const std::string_view option = args[i];
+        const bool has_value =
+            option == "--seed" || option == "--bytes" || option == "--block-size" || option == "--endianness";
+        const std::string_view value =
+            (has_value && i + 1 < args.size()) ? std::string_view(args[++i]) : std::string_view();
+        bool valid = true;
+        if (option == "--par")
+            options.parallel = true;
+        else if (option == "--verbose")
+            options.verbose = true;
+        else if (has_value)
+        {
+            if (option == "--seed")
+            {
+                // Parsed with the width of the seed of the engine.
+                valid = !value.empty();
+                options.seed = value;
+            }
+            else if (option == "--endianness")
+            {
+                valid = value == "specific" || value == "neutral";
+                options.neutral_endianness = value == "neutral";
+            }
+            else
+            {
+                const std::optional size = parse_size(value);
+                // The blocks are whole numbers of 64-bit values, so that the partial values do not cut the stream.
+                valid = size.has_value() && (option == "--bytes" || (*size > 0 && *size % sizeof(uint64_t) == 0));
+                (option == "--bytes" ? options.nb_bytes : options.block_size) = size.value_or(0);
+            }
+        }
+        else
+            valid = false;
+
+        if (!valid)
+        {
+            std::cerr << "rnrg_stream: invalid option '" << option << (has_value ? " " : "") << value << "'"
+                      << std::endl;
+            print_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+#if __has_include(<unistd.h>)
+    // A reader closing the pipe (e.g. a test battery done with the stream) ends the stream with EPIPE.
+    std::signal(SIGPIPE, SIG_IGN);
+#elif defined(_WIN32)
+    // In text mode, each 0x0A byte would be written as 0x0D 0x0A.
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    return engine_iter->stream(options);
+}